@@ -94,6 +94,9 @@ RODUAFrame::addImportOptions() {
     oc.doRegister("weights.expand", new Option_Bool(false));
     oc.addSynonyme("weights.expand", "expand-weights", true);
     oc.addDescription("weights.expand", "Processing", "Expand weights behind the simulation's end");
+
+    oc.doRegister("route-cache", new Option_Bool(false));
+    oc.addDescription("route-cache", "Processing", "Reuse the routes found for the same origin, destination and vehicle class (within the same weight-period)");
 }
 
 
@@ -43,12 +43,14 @@
 #include <ctime>
 #include <router/ROLoader.h>
 #include <router/RONet.h>
+#include <router/RORouteHandler.h>
 #include <router/ROEdge.h>
 #include <utils/vehicle/DijkstraRouterTT.h>
 #include <utils/vehicle/DijkstraRouterEffort.h>
 #include <utils/vehicle/AStarRouter.h>
 #include <utils/vehicle/CHRouter.h>
 #include <utils/vehicle/CHRouterWrapper.h>
+#include <utils/vehicle/RouteCache.h>
 #include "RODUAEdgeBuilder.h"
 #include <router/ROFrame.h>
 #include <utils/common/MsgHandler.h>
@@ -184,6 +186,11 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
                 ROEdge::getAllEdges(), oc.getBool("ignore-errors"), op, &ROEdge::getTravelTimeStatic);
         }
     }
+    if (oc.getBool("route-cache")) {
+        // loaded weights may change with each weight period
+        const SUMOTime weightPeriod = oc.isSet("weight-files") || oc.isSet("lane-weight-files") ? string2time(oc.getString("weight-period")) : 0;
+        router = new CachedRouter<ROEdge, ROVehicle>(router, net.getRouteCache(), weightPeriod);
+    }
     RORouterProvider provider(router, new PedestrianRouterDijkstra<ROEdge, ROLane, RONode, ROVehicle>(),
                               new ROIntermodalRouter(RONet::adaptIntermodalRouter));
     // process route definitions
@@ -226,6 +233,7 @@ main(int argc, char** argv) {
             throw ProcessError();
         }
         RandHelper::initRandGlobal();
+        RORouteHandler::initParsingRNG();
         // load data
         ROLoader loader(oc, false, !oc.getBool("no-step-log"));
         net = new RONet();
@@ -1311,6 +1311,9 @@ GUIApplicationWindow::handleEvent_SimulationLoaded(GUIEvent* e) {
             } else {
                 openNewView(defaultType);
             }
+            if (GUIGlobals::gBenchmarkFrames > 0 && myMDIClient->numChildren() > 0) {
+                static_cast<GUISUMOViewParent*>(myMDIClient->childAtIndex(0))->getView()->benchmark(GUIGlobals::gBenchmarkFrames);
+            }
 
             if (isGaming()) {
                 setTitle("SUMO Interactive Traffic Light");
@@ -1537,6 +1540,12 @@ GUIApplicationWindow::closeAllWindows() {
             (*it)->hide();
         }
     }
+    // free the display lists of the lanes while the views sharing them are still open
+    FXGLCanvas* const canvas = getBuildGLCanvas();
+    if (myRunThread->simulationAvailable() && canvas != 0 && canvas->makeCurrent()) {
+        myRunThread->getNet().releaseDisplayLists();
+        canvas->makeNonCurrent();
+    }
     // remove trackers and other external windows
     int i;
     for (i = 0; i < (int)mySubWindows.size(); ++i) {
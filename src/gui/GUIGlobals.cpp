@@ -48,4 +48,7 @@ bool GUIGlobals::gQuitOnEnd = false;
 bool GUIGlobals::gDemoAutoReload = false;
 
 
+int GUIGlobals::gBenchmarkFrames = 0;
+
+
 /****************************************************************************/
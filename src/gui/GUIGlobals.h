@@ -57,6 +57,9 @@ public:
     /// the simulation shall reload when it has ended (demo)
     static bool gDemoAutoReload;
 
+    /// the number of frames the first view shall draw after loading for measuring the drawing performance
+    static int gBenchmarkFrames;
+
 };
 
 #endif
@@ -145,10 +145,15 @@ GUILoadThread::run() {
         if (!MSFrame::checkOptions()) {
             throw ProcessError();
         }
+        if (oc.getInt("dua.iterations") > 1) {
+            // the net would be reset and simulated again without the views noticing
+            throw ProcessError("An assignment (option dua.iterations) can only be run by sumo.");
+        }
         XMLSubSys::setValidation(oc.getString("xml-validation"), oc.getString("xml-validation.net"));
         GUIGlobals::gRunAfterLoad = oc.getBool("start");
         GUIGlobals::gQuitOnEnd = oc.getBool("quit-on-end");
         GUIGlobals::gDemoAutoReload = oc.getBool("demo");
+        GUIGlobals::gBenchmarkFrames = oc.getInt("gui-benchmark");
     } catch (ProcessError& e) {
         if (std::string(e.what()) != std::string("Process Error") && std::string(e.what()) != std::string("")) {
             WRITE_ERROR(e.what());
@@ -81,9 +81,15 @@ GUILane::GUILane(const std::string& id, SUMOReal maxSpeed, SUMOReal length,
                  SVCPermissions permissions, int index) :
     MSLane(id, maxSpeed, length, edge, numericalID, shape, width, permissions, index),
     GUIGlObject(GLO_LANE, id),
-    myAmClosed(false) {
+    myAmClosed(false),
+    myMarkingsList(0),
+    myMarkingsListHasInverse(false),
+    myBikeMarkingsList(0),
+    myCrosstiesList(0),
+    myListsGeneration(GUISUMOAbstractView::getDisplayListGeneration()) {
     if (MSGlobals::gUseMesoSim) {
         myShape = splitAtSegments(shape);
+        myShape.buildLengthIndex();
         assert(fabs(myShape.length() - shape.length()) < POSITION_EPS);
         assert(myShapeSegments.size() == myShape.size());
     }
@@ -620,8 +626,28 @@ GUILane::drawMarkings(const GUIVisualizationSettings& s, SUMOReal scale) const {
     if (!MSGlobals::gUseMesoSim) {
         setColor(s);
     }
+    const bool drawInverse = myIndex > 0 && (myEdge->getLanes()[myIndex - 1]->getPermissions() & myPermissions) != 0;
+    checkListsGeneration();
+    if (scale != 1.) {
+        performMarkings(drawInverse, scale);
+    } else {
+        // the markings only change with the permissions of the neighboring lane, replay them from a display list
+        if (myMarkingsList == 0 || drawInverse != myMarkingsListHasInverse) {
+            compileList(myMarkingsList);
+            performMarkings(drawInverse, scale);
+            glEndList();
+            myMarkingsListHasInverse = drawInverse;
+        }
+        glCallList(myMarkingsList);
+    }
+    glPopMatrix();
+}
+
+
+void
+GUILane::performMarkings(bool drawInverse, SUMOReal scale) const {
     // optionally draw inverse markings
-    if (myIndex > 0 && (myEdge->getLanes()[myIndex - 1]->getPermissions() & myPermissions) != 0) {
+    if (drawInverse) {
         SUMOReal mw = (myHalfLaneWidth + SUMO_const_laneOffset + .01) * scale * (MSNet::getInstance()->lefthand() ? -1 : 1);
         int e = (int) getShape().size() - 1;
         for (int i = 0; i < e; ++i) {
@@ -647,12 +673,23 @@ GUILane::drawMarkings(const GUIVisualizationSettings& s, SUMOReal scale) const {
         getShapeRotations(),
         getShapeLengths(),
         (myHalfLaneWidth + SUMO_const_laneOffset) * scale);
-    glPopMatrix();
 }
 
 
 void
 GUILane::drawBikeMarkings() const {
+    checkListsGeneration();
+    if (myBikeMarkingsList == 0) {
+        compileList(myBikeMarkingsList);
+        performBikeMarkings();
+        glEndList();
+    }
+    glCallList(myBikeMarkingsList);
+}
+
+
+void
+GUILane::performBikeMarkings() const {
     // draw bike lane markings onto the intersection
     glColor3d(1, 1, 1);
     int e = (int) getShape().size() - 1;
@@ -678,6 +715,19 @@ GUILane::drawBikeMarkings() const {
 
 void
 GUILane::drawCrossties(SUMOReal length, SUMOReal spacing, SUMOReal halfWidth) const {
+    checkListsGeneration();
+    if (myCrosstiesList == 0 || length != myCrosstiesListParams.x() || spacing != myCrosstiesListParams.y() || halfWidth != myCrosstiesListParams.z()) {
+        compileList(myCrosstiesList);
+        performCrossties(length, spacing, halfWidth);
+        glEndList();
+        myCrosstiesListParams.set(length, spacing, halfWidth);
+    }
+    glCallList(myCrosstiesList);
+}
+
+
+void
+GUILane::performCrossties(SUMOReal length, SUMOReal spacing, SUMOReal halfWidth) const {
     glPushMatrix();
     // draw on top of of the white area between the rails
     glTranslated(0, 0, 0.1);
@@ -1117,6 +1167,48 @@ GUILane::closeTraffic(bool rebuildAllowed) {
 }
 
 
+void
+GUILane::compileList(GLuint& list) {
+    if (list == 0) {
+        list = glGenLists(1);
+        if (list == 0) {
+            throw ProcessError("GUILane::compileList() could not create display list");
+        }
+    }
+    glNewList(list, GL_COMPILE);
+}
+
+
+void
+GUILane::checkListsGeneration() const {
+    if (myListsGeneration != GUISUMOAbstractView::getDisplayListGeneration()) {
+        // the lists were deleted together with the GL context of the closed views
+        myMarkingsList = 0;
+        myBikeMarkingsList = 0;
+        myCrosstiesList = 0;
+        myListsGeneration = GUISUMOAbstractView::getDisplayListGeneration();
+    }
+}
+
+
+void
+GUILane::releaseLists() {
+    checkListsGeneration();
+    if (myMarkingsList != 0) {
+        glDeleteLists(myMarkingsList, 1);
+    }
+    if (myBikeMarkingsList != 0) {
+        glDeleteLists(myBikeMarkingsList, 1);
+    }
+    if (myCrosstiesList != 0) {
+        glDeleteLists(myCrosstiesList, 1);
+    }
+    myMarkingsList = 0;
+    myBikeMarkingsList = 0;
+    myCrosstiesList = 0;
+}
+
+
 PositionVector
 GUILane::splitAtSegments(const PositionVector& shape) {
     assert(MSGlobals::gUseMesoSim);
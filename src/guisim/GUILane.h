@@ -41,6 +41,7 @@
 #include <utils/geom/Position.h>
 #include <utils/geom/PositionVector.h>
 #include <utils/gui/globjects/GUIGlObject.h>
+#include <utils/gui/globjects/GLIncludes.h>
 #include <utils/gui/settings/GUIPropertySchemeStorage.h>
 
 
@@ -253,6 +254,12 @@ public:
         return myAmClosed;
     }
 
+    /** @brief Frees the display lists if the views they were recorded for are still open
+     *
+     * Must be called from the GUI thread with the GL context of the views being current.
+     */
+    void releaseLists();
+
 protected:
     /// moves myTmpVehicles int myVehicles after a lane change procedure
     void swapAfterLaneChange(SUMOTime t);
@@ -283,6 +290,16 @@ private:
     void drawArrows() const;
     void drawLane2LaneConnections() const;
 
+    /// @brief the immediate mode drawing of the static lane decorations (recorded into display lists)
+    void performMarkings(bool drawInverse, SUMOReal scale) const;
+    void performBikeMarkings() const;
+    void performCrossties(SUMOReal length, SUMOReal spacing, SUMOReal halfWidth) const;
+
+    /// @brief allocates the given display list if necessary and starts recording it
+    static void compileList(GLuint& list);
+
+    /// @brief forgets the display lists if they were recorded for views which are closed by now
+    void checkListsGeneration() const;
 
     /// @brief add intermediate points at segment borders
     PositionVector splitAtSegments(const PositionVector& shape);
@@ -334,6 +351,24 @@ private:
     /// @brief state for dynamic lane closings
     bool myAmClosed;
 
+    /// @name Display lists of the static lane decorations
+    /// @note display lists are shared between all views and released together with their GL context,
+    ///  see GUISUMOAbstractView::getDisplayListGeneration
+    /// @{
+    /// @brief the lane borders and white markings
+    mutable GLuint myMarkingsList;
+    /// @brief whether myMarkingsList contains the inverse markings
+    mutable bool myMarkingsListHasInverse;
+    /// @brief the bike lane markings on top of an intersection
+    mutable GLuint myBikeMarkingsList;
+    /// @brief the crossties of railways and pedestrian crossings
+    mutable GLuint myCrosstiesList;
+    /// @brief the length, spacing and half width myCrosstiesList was built for
+    mutable Position myCrosstiesListParams;
+    /// @brief the display list namespace the lists were recorded in
+    mutable int myListsGeneration;
+    /// @}
+
 private:
     /// The mutex used to avoid concurrent updates of the vehicle buffer
     mutable MFXMutex myLock;
@@ -226,6 +226,17 @@ GUINet::guiSimulationStep() {
 }
 
 
+void
+GUINet::releaseDisplayLists() {
+    for (std::vector<GUIEdge*>::const_iterator i = myEdgeWrapper.begin(); i != myEdgeWrapper.end(); ++i) {
+        const std::vector<MSLane*>& lanes = (*i)->getLanes();
+        for (std::vector<MSLane*>::const_iterator j = lanes.begin(); j != lanes.end(); ++j) {
+            static_cast<GUILane*>(*j)->releaseLists();
+        }
+    }
+}
+
+
 void
 GUINet::simulationStep() {
     AbstractMutex::ScopedLocker locker(myLock);
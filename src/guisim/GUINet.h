@@ -160,6 +160,14 @@ public:
     /// Some further steps needed for gui processing
     void guiSimulationStep();
 
+    /** @brief Frees the display lists of the lanes
+     *
+     * Has to be called from the GUI thread while the views are open and
+     *  the GL context they share is current. Lists which are not freed
+     *  before the views close are released together with their context.
+     */
+    void releaseDisplayLists();
+
     /** @brief Performs a single simulation step (locking the simulation)
      */
     void simulationStep();
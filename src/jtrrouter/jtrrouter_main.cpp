@@ -56,6 +56,7 @@
 #include <router/ROFrame.h>
 #include <router/ROLoader.h>
 #include <router/RONet.h>
+#include <router/RORouteHandler.h>
 #include <router/RORouteDef.h>
 #include "ROJTREdgeBuilder.h"
 #include "ROJTRRouter.h"
@@ -189,6 +190,7 @@ main(int argc, char** argv) {
             throw ProcessError();
         }
         RandHelper::initRandGlobal();
+        RORouteHandler::initParsingRNG();
         std::vector<SUMOReal> defs = getTurningDefaults(oc);
         // load data
         ROLoader loader(oc, true, !oc.getBool("no-step-log"));
@@ -69,6 +69,7 @@
 #include <router/ROEdge.h>
 #include <router/ROLoader.h>
 #include <router/RONet.h>
+#include <router/RORouteHandler.h>
 #include <router/RORoute.h>
 #include <router/RORoutable.h>
 
@@ -430,6 +431,7 @@ main(int argc, char** argv) {
             throw ProcessError();
         }
         RandHelper::initRandGlobal();
+        RORouteHandler::initParsingRNG();
         // load data
         ROLoader loader(oc, false, false);
         net = new RONet();
@@ -658,6 +658,29 @@ MESegment::loadState(std::vector<std::string>& vehIds, MSVehicleControl& vc, con
 }
 
 
+void
+MESegment::clearState(SUMOTime currentTime) {
+    for (Queues::iterator k = myCarQues.begin(); k != myCarQues.end(); ++k) {
+        if (k->empty()) {
+            continue;
+        }
+        // only the last vehicle of a queue is known to the loop and approaches the link
+        MEVehicle* const leader = k->back();
+        MSLink* const link = getLink(leader);
+        if (link != 0) {
+            link->removeApproaching(leader);
+        }
+        MSGlobals::gMesoNet->removeLeaderCar(leader);
+        while (!k->empty()) {
+            removeCar(k->back(), currentTime, &myVaporizationTarget);
+        }
+    }
+    std::fill(myBlockTimes.begin(), myBlockTimes.end(), -1);
+    myEntryBlockTime = SUMOTime_MIN;
+    myLastMeanSpeedUpdate = SUMOTime_MIN;
+}
+
+
 std::vector<const MEVehicle*>
 MESegment::getVehicles() const {
     std::vector<const MEVehicle*> result;
@@ -320,6 +320,14 @@ public:
      * @todo What about throwing an error if something else fails (a vehicle can not be referenced)?
      */
     void loadState(std::vector<std::string>& vehIDs, MSVehicleControl& vc, const SUMOTime blockTime, const int queIdx);
+
+    /** @brief Removes all vehicles from this segment and resets its blocking times
+     *
+     * The vehicles are vaporized (their detectors are notified) but not deleted.
+     *
+     * @param[in] currentTime The current simulation time
+     */
+    void clearState(SUMOTime currentTime);
     /// @}
 
 
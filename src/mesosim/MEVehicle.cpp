@@ -381,6 +381,7 @@ MEVehicle::loadState(const SUMOSAXAttributes& attrs, const SUMOTime offset) {
     if (myBlockTime != SUMOTime_MAX) {
         myBlockTime -= offset;
     }
+    loadRandomDraws(attrs);
 }
 
 
@@ -31,11 +31,14 @@
 #endif
 
 #include <iostream>
+#include <sstream>
 #include <cassert>
+#include <cmath>
 #include <utils/common/StdDefs.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/xml/SUMOSAXAttributes.h>
 #include "MSGlobals.h"
 #include "MSVehicleType.h"
 #include "MSEdge.h"
@@ -78,7 +81,9 @@ MSBaseVehicle::MSBaseVehicle(SUMOVehicleParameter* pars, const MSRoute* route,
     myDepartPos(-1),
     myArrivalPos(-1),
     myArrivalLane(-1),
-    myNumberReroutes(0)
+    myNumberReroutes(0),
+    myRandomStream(RandHelper::getStreamID(pars->id)),
+    myRandomDraws(0)
 #ifdef _DEBUG
     , myTraceMoveReminders(myShallTraceMoveReminders.count(pars->id) > 0)
 #endif
@@ -384,7 +389,7 @@ MSBaseVehicle::calculateArrivalParams() {
             }
             break;
         case ARRIVAL_POS_RANDOM:
-            myArrivalPos = RandHelper::rand(static_cast<SUMOReal>(0), lastLaneLength);
+            myArrivalPos = randStream() * lastLaneLength;
             break;
         default:
             myArrivalPos = lastLaneLength;
@@ -416,6 +421,19 @@ MSBaseVehicle::getImpatience() const {
 }
 
 
+SUMOReal
+MSBaseVehicle::randNormStream(SUMOReal mean, SUMOReal variance) const {
+    // Polar method as in RandHelper::randNorm
+    SUMOReal u, q;
+    do {
+        u = 2 * randStream() - 1;
+        const SUMOReal v = 2 * randStream() - 1;
+        q = u * u + v * v;
+    } while (q == 0. || q >= 1.);
+    return (SUMOReal)(mean + variance * u * sqrt(-2 * log(q) / q));
+}
+
+
 MSDevice*
 MSBaseVehicle::getDevice(const std::type_info& type) const {
     for (std::vector<MSDevice*>::const_iterator dev = myDevices.begin(); dev != myDevices.end(); ++dev) {
@@ -433,11 +451,22 @@ MSBaseVehicle::saveState(OutputDevice& out) {
     out.writeAttr(SUMO_ATTR_DEPART, time2string(myParameter->depart));
     out.writeAttr(SUMO_ATTR_ROUTE, myRoute->getID());
     out.writeAttr(SUMO_ATTR_TYPE, myType->getID());
+    out.writeAttr(SUMO_ATTR_RANDOM_DRAWS, myRandomDraws);
     // here starts the vehicle internal part (see loading)
     // @note: remember to close the vehicle tag when calling this in a subclass!
 }
 
 
+void
+MSBaseVehicle::loadRandomDraws(const SUMOSAXAttributes& attrs) {
+    // states saved before the vehicles had their own streams do not contain it
+    if (attrs.hasAttribute(SUMO_ATTR_RANDOM_DRAWS)) {
+        std::istringstream bis(attrs.getString(SUMO_ATTR_RANDOM_DRAWS));
+        bis >> myRandomDraws;
+    }
+}
+
+
 void
 MSBaseVehicle::addStops(const bool ignoreStopErrors) {
     for (std::vector<SUMOVehicleParameter::Stop>::const_iterator i = myParameter->stops.begin(); i != myParameter->stops.end(); ++i) {
@@ -37,6 +37,8 @@
 #include <set>
 #include <utils/vehicle/SUMOVehicle.h>
 #include <utils/common/StdDefs.h>
+#include <utils/common/MemoryPool.h>
+#include <utils/common/RandHelper.h>
 #include "MSRoute.h"
 #include "MSMoveReminder.h"
 #include "MSVehicleType.h"
@@ -80,6 +82,18 @@ public:
     /// @brief Destructor
     virtual ~MSBaseVehicle();
 
+#ifndef CHECK_MEMORY_LEAKS
+    /// @brief Vehicles are allocated from the MemoryPool
+    static void* operator new(size_t size) {
+        return MemoryPool::allocate(size);
+    }
+
+    /// @brief Vehicles return their memory to the MemoryPool
+    static void operator delete(void* p, size_t size) {
+        MemoryPool::deallocate(p, size);
+    }
+#endif
+
 
     /// Returns the name of the vehicle
     const std::string& getID() const;
@@ -285,6 +299,27 @@ public:
     SUMOReal getImpatience() const;
 
 
+    /** @brief Returns a random number in [0, 1) from this vehicle's own random stream
+     *
+     * The stream is keyed by the seed and the vehicle id, so the drawn numbers do
+     *  not depend on the order in which vehicles are processed.
+     * @return The next random number of this vehicle
+     * @see RandHelper::randCounterBased
+     */
+    inline SUMOReal randStream() const {
+        return RandHelper::randCounterBased(myRandomStream, myRandomDraws++);
+    }
+
+
+    /** @brief Returns a normal distributed random number from this vehicle's own random stream
+     * @param[in] mean The mean of the distribution
+     * @param[in] variance The standard deviation of the distribution
+     * @return The next random number of this vehicle
+     * @see RandHelper::randNorm
+     */
+    SUMOReal randNormStream(SUMOReal mean, SUMOReal variance) const;
+
+
     /** @brief Returns this vehicle's devices
      * @return This vehicle's devices
      */
@@ -386,6 +421,11 @@ protected:
      */
     virtual const ConstMSEdgeVector getStopEdges() const = 0;
 
+    /** @brief Restores the number of random numbers drawn from this vehicle's stream
+     * @param[in] attrs The attributes of the vehicle's saved state
+     */
+    void loadRandomDraws(const SUMOSAXAttributes& attrs);
+
 protected:
     /// @brief This Vehicle's parameter.
     const SUMOVehicleParameter* myParameter;
@@ -435,6 +475,12 @@ protected:
     /// @brief The number of reroutings
     int myNumberReroutes;
 
+    /// @brief The id of this vehicle's random stream
+    const unsigned long long myRandomStream;
+
+    /// @brief The number of random numbers drawn from this vehicle's stream so far
+    mutable unsigned long long myRandomDraws;
+
     /* @brief magic value for undeparted vehicles
      * @note: in previous versions this was -1
      */
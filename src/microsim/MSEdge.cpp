@@ -265,6 +265,8 @@ MSEdge::rebuildAllowedLanes() {
         myMinimumPermissions &= (*i)->getPermissions();
         myCombinedPermissions |= (*i)->getPermissions();
     }
+    // the shared best lanes depend on the permissions
+    MSVehicle::clearBestLanesCache();
 }
 
 
@@ -421,8 +423,10 @@ MSEdge::getDepartLane(MSVehicle& veh) const {
                 return 0;
             }
             return (*myLanes)[veh.getParameter().departLane];
-        case DEPART_LANE_RANDOM:
-            return RandHelper::getRandomFrom(*allowedLanes(veh.getVehicleType().getVehicleClass()));
+        case DEPART_LANE_RANDOM: {
+            const std::vector<MSLane*>* const lanes = allowedLanes(veh.getVehicleType().getVehicleClass());
+            return (*lanes)[MIN2((int)(veh.randStream() * (SUMOReal)lanes->size()), (int)lanes->size() - 1)];
+        }
         case DEPART_LANE_FREE:
             return getFreeLane(0, veh.getVehicleType().getVehicleClass());
         case DEPART_LANE_ALLOWED_FREE:
@@ -520,7 +524,7 @@ MSEdge::insertVehicle(SUMOVehicle& v, SUMOTime time, const bool checkOnly) const
                 break;
             case DEPART_POS_RANDOM:
             case DEPART_POS_RANDOM_FREE:
-                pos = RandHelper::rand(getLength());
+                pos = static_cast<MSBaseVehicle&>(v).randStream() * getLength();
                 break;
             default:
                 break;
@@ -640,9 +644,8 @@ MSEdge::getMeanSpeed() const {
         }
     } else {
         for (std::vector<MSLane*>::const_iterator i = myLanes->begin(); i != myLanes->end(); ++i) {
-            const SUMOReal vehNo = (SUMOReal)(*i)->getVehicleNumber();
-            v += vehNo * (*i)->getMeanSpeed();
-            no += vehNo;
+            v += (*i)->getSpeedSum();
+            no += (SUMOReal)(*i)->getVehicleNumber();
         }
         if (no == 0) {
             return getSpeedLimit();
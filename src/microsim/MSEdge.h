@@ -467,6 +467,17 @@ public:
         return MSNet::getInstance()->getTravelTime(edge, veh, time);
     }
 
+    /** @brief Returns the travel time for this edge using the net's weights storage
+     *
+     * @param[in] veh The vehicle for which the travel time on this edge shall be retrieved
+     * @param[in] time The time for which the travel time shall be returned [s]
+     * @return The traveltime needed by the given vehicle to pass this edge at the given time
+     * @see getTravelTimeStatic
+     */
+    inline SUMOReal getTravelTime(const SUMOVehicle* const veh, SUMOReal time) const {
+        return MSNet::getInstance()->getTravelTime(this, veh, time);
+    }
+
     /** @brief Returns the averaged speed used by the routing device
      */
     SUMOReal getRoutingSpeed() const;
@@ -100,6 +100,7 @@ MSEdgeControl::patchActiveLanes() {
 
 void
 MSEdgeControl::planMovements(SUMOTime t) {
+    MSLane::invalidateOccupancy();
     for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end();) {
         if ((*i)->getVehicleNumber() == 0) {
             myLanes[(*i)->getNumericalID()].amActive = false;
@@ -114,6 +115,8 @@ MSEdgeControl::planMovements(SUMOTime t) {
 
 void
 MSEdgeControl::executeMovements(SUMOTime t) {
+    // vehicles also move on lanes which they only touch partially
+    MSLane::invalidateOccupancy();
     myWithVehicles2Integrate.clear();
     for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end();) {
         if ((*i)->getVehicleNumber() == 0 || (*i)->executeMovements(t, myWithVehicles2Integrate)) {
@@ -143,11 +146,13 @@ MSEdgeControl::executeMovements(SUMOTime t) {
             (*it).lane->sortPartialVehicles();
         }
     }
+    MSLane::invalidateOccupancy();
 }
 
 
 void
 MSEdgeControl::changeLanes(SUMOTime t) {
+    MSLane::invalidateOccupancy();
     std::vector<MSLane*> toAdd;
     for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end();) {
         LaneUsage& lu = myLanes[(*i)->getNumericalID()];
@@ -177,6 +182,7 @@ MSEdgeControl::changeLanes(SUMOTime t) {
     for (std::vector<MSLane*>::iterator i = toAdd.begin(); i != toAdd.end(); ++i) {
         myActiveLanes.push_front(*i);
     }
+    MSLane::invalidateOccupancy();
 }
 
 
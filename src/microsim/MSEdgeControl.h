@@ -161,6 +161,12 @@ public:
     }
 
 
+    /// @brief Returns the number of lanes with vehicles (counts the list)
+    int getActiveLaneNumber() const {
+        return (int)myActiveLanes.size();
+    }
+
+
     /** @brief Returns the list of names of all known edges
      *
      * @return a vector of names of all known edges
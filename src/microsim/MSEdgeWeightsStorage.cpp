@@ -30,6 +30,7 @@
 #endif
 
 #include "MSEdgeWeightsStorage.h"
+#include "MSEdge.h"
 
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
@@ -39,7 +40,8 @@
 // ===========================================================================
 // method definitions
 // ===========================================================================
-MSEdgeWeightsStorage::MSEdgeWeightsStorage() {
+MSEdgeWeightsStorage::MSEdgeWeightsStorage(const bool indexed) :
+    myTravelTimes(indexed), myEfforts(indexed) {
 }
 
 
@@ -49,30 +51,22 @@ MSEdgeWeightsStorage::~MSEdgeWeightsStorage() {
 
 bool
 MSEdgeWeightsStorage::retrieveExistingTravelTime(const MSEdge* const e, const SUMOReal t, SUMOReal& value) const {
-    std::map<const MSEdge*, ValueTimeLine<SUMOReal> >::const_iterator i = myTravelTimes.find(e);
-    if (i == myTravelTimes.end()) {
+    const ValueTimeLine<SUMOReal>* const tl = myTravelTimes.get(e);
+    if (tl == 0 || !tl->describesTime(t)) {
         return false;
     }
-    const ValueTimeLine<SUMOReal>& tl = (*i).second;
-    if (!tl.describesTime(t)) {
-        return false;
-    }
-    value = tl.getValue(t);
+    value = tl->getValue(t);
     return true;
 }
 
 
 bool
 MSEdgeWeightsStorage::retrieveExistingEffort(const MSEdge* const e, const SUMOReal t, SUMOReal& value) const {
-    std::map<const MSEdge*, ValueTimeLine<SUMOReal> >::const_iterator i = myEfforts.find(e);
-    if (i == myEfforts.end()) {
+    const ValueTimeLine<SUMOReal>* const tl = myEfforts.get(e);
+    if (tl == 0 || !tl->describesTime(t)) {
         return false;
     }
-    const ValueTimeLine<SUMOReal>& tl = (*i).second;
-    if (!tl.describesTime(t)) {
-        return false;
-    }
-    value = tl.getValue(t);
+    value = tl->getValue(t);
     return true;
 }
 
@@ -81,12 +75,7 @@ void
 MSEdgeWeightsStorage::addTravelTime(const MSEdge* const e,
                                     SUMOReal begin, SUMOReal end,
                                     SUMOReal value) {
-    std::map<const MSEdge*, ValueTimeLine<SUMOReal> >::iterator i = myTravelTimes.find(e);
-    if (i == myTravelTimes.end()) {
-        myTravelTimes[e] = ValueTimeLine<SUMOReal>();
-        i = myTravelTimes.find(e);
-    }
-    (*i).second.add(begin, end, value);
+    myTravelTimes.getOrAdd(e).add(begin, end, value);
 }
 
 
@@ -94,45 +83,77 @@ void
 MSEdgeWeightsStorage::addEffort(const MSEdge* const e,
                                 SUMOReal begin, SUMOReal end,
                                 SUMOReal value) {
-    std::map<const MSEdge*, ValueTimeLine<SUMOReal> >::iterator i = myEfforts.find(e);
-    if (i == myEfforts.end()) {
-        myEfforts[e] = ValueTimeLine<SUMOReal>();
-        i = myEfforts.find(e);
-    }
-    (*i).second.add(begin, end, value);
+    myEfforts.getOrAdd(e).add(begin, end, value);
 }
 
 
 void
 MSEdgeWeightsStorage::removeTravelTime(const MSEdge* const e) {
-    std::map<const MSEdge*, ValueTimeLine<SUMOReal> >::iterator i = myTravelTimes.find(e);
-    if (i != myTravelTimes.end()) {
-        myTravelTimes.erase(i);
-    }
+    myTravelTimes.remove(e);
 }
 
 
 void
 MSEdgeWeightsStorage::removeEffort(const MSEdge* const e) {
-    std::map<const MSEdge*, ValueTimeLine<SUMOReal> >::iterator i = myEfforts.find(e);
-    if (i != myEfforts.end()) {
-        myEfforts.erase(i);
-    }
+    myEfforts.remove(e);
 }
 
 
 bool
 MSEdgeWeightsStorage::knowsTravelTime(const MSEdge* const e) const {
-    return myTravelTimes.find(e) != myTravelTimes.end();
+    return myTravelTimes.get(e) != 0;
 }
 
 
 bool
 MSEdgeWeightsStorage::knowsEffort(const MSEdge* const e) const {
-    return myEfforts.find(e) != myEfforts.end();
+    return myEfforts.get(e) != 0;
+}
+
+
+// ---------------------------------------------------------------------------
+// MSEdgeWeightsStorage::TimeLines - methods
+// ---------------------------------------------------------------------------
+const ValueTimeLine<SUMOReal>*
+MSEdgeWeightsStorage::TimeLines::get(const MSEdge* const e) const {
+    if (myAmIndexed) {
+        const int index = e->getNumericalID();
+        if (index >= (int)myIndexed.size() || myIndexed[index].empty()) {
+            return 0;
+        }
+        return &myIndexed[index];
+    }
+    std::map<const MSEdge*, ValueTimeLine<SUMOReal> >::const_iterator i = mySparse.find(e);
+    if (i == mySparse.end() || i->second.empty()) {
+        return 0;
+    }
+    return &i->second;
+}
+
+
+ValueTimeLine<SUMOReal>&
+MSEdgeWeightsStorage::TimeLines::getOrAdd(const MSEdge* const e) {
+    if (myAmIndexed) {
+        const int index = e->getNumericalID();
+        if (index >= (int)myIndexed.size()) {
+            myIndexed.resize(index + 1);
+        }
+        return myIndexed[index];
+    }
+    return mySparse[e];
 }
 
 
+void
+MSEdgeWeightsStorage::TimeLines::remove(const MSEdge* const e) {
+    if (myAmIndexed) {
+        if (e->getNumericalID() < (int)myIndexed.size()) {
+            myIndexed[e->getNumericalID()] = ValueTimeLine<SUMOReal>();
+        }
+    } else {
+        mySparse.erase(e);
+    }
+}
 
 /****************************************************************************/
 
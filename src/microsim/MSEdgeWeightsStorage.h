@@ -31,6 +31,8 @@
 #include <config.h>
 #endif
 
+#include <map>
+#include <vector>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/ValueTimeLine.h>
 
@@ -48,11 +50,17 @@ class SUMOVehicle;
 /**
  * @class MSEdgeWeightsStorage
  * @brief A storage for edge travel times and efforts
+ *
+ * The global storage of the network usually knows most edges and keeps its
+ *  time lines in vectors indexed by the edges' numerical ids. Storages of
+ *  single vehicles only describe a few edges and keep them in maps.
  */
 class MSEdgeWeightsStorage {
 public:
-    /// @brief Constructor
-    MSEdgeWeightsStorage();
+    /** @brief Constructor
+     * @param[in] indexed Whether the time lines shall be indexed by numerical edge id (for storages describing many edges)
+     */
+    MSEdgeWeightsStorage(const bool indexed = false);
 
 
     /// @brief Destructor
@@ -122,11 +130,40 @@ public:
 
 
 private:
-    /// @brief A map of edge->time->travel time
-    std::map<const MSEdge*, ValueTimeLine<SUMOReal> > myTravelTimes;
+    /**
+     * @class TimeLines
+     * @brief The time lines of the described edges, an empty time line means no information
+     */
+    class TimeLines {
+    public:
+        /// @brief Constructor
+        TimeLines(const bool indexed) : myAmIndexed(indexed) {}
+
+        /// @brief Returns the time line of the given edge if it is not empty (0 otherwise)
+        const ValueTimeLine<SUMOReal>* get(const MSEdge* const e) const;
+
+        /// @brief Returns the time line of the given edge (adding an empty one if needed)
+        ValueTimeLine<SUMOReal>& getOrAdd(const MSEdge* const e);
+
+        /// @brief Removes the time line of the given edge
+        void remove(const MSEdge* const e);
+
+    private:
+        /// @brief Whether the time lines are indexed by numerical edge id
+        const bool myAmIndexed;
+
+        /// @brief edge (by numerical id)->time->value if indexed
+        std::vector<ValueTimeLine<SUMOReal> > myIndexed;
+
+        /// @brief edge->time->value otherwise
+        std::map<const MSEdge*, ValueTimeLine<SUMOReal> > mySparse;
+    };
+
+    /// @brief edge->time->travel time
+    TimeLines myTravelTimes;
 
-    /// @brief A map of edge->time->effort
-    std::map<const MSEdge*, ValueTimeLine<SUMOReal> > myEfforts;
+    /// @brief edge->time->effort
+    TimeLines myEfforts;
 
 
 private:
@@ -120,6 +120,33 @@ MSEventControl::isEmpty() {
     return myEvents.empty();
 }
 
+void
+MSEventControl::clearState(SUMOTime currentTime, SUMOTime newTime) {
+    EventCont moved;
+    while (!myEvents.empty()) {
+        Event e = myEvents.top();
+        myEvents.pop();
+        try {
+            e.second = e.first->shiftTime(currentTime, e.second, newTime);
+        } catch (...) {
+            // keep all events so they are deleted with this control
+            myEvents.push(e);
+            while (!moved.empty()) {
+                myEvents.push(moved.top());
+                moved.pop();
+            }
+            throw;
+        }
+        if (e.second < 0) {
+            delete e.first;
+        } else {
+            moved.push(e);
+        }
+    }
+    myEvents = moved;
+}
+
+
 void
 MSEventControl::setCurrentTimeStep(SUMOTime time) {
     currentTimeStep = time;
@@ -126,6 +126,19 @@ public:
     bool isEmpty();
 
 
+    /** @brief Reschedules all events for a new time
+     *
+     * Used when the simulation time is reset. Each command is asked for its
+     *  new execution time (Command::shiftTime); commands returning a negative
+     *  time are deleted.
+     *
+     * @param[in] currentTime The current simulation time
+     * @param[in] newTime The time the simulation continues at
+     * @exception ProcessError If one of the commands cannot be rescheduled
+     */
+    void clearState(SUMOTime currentTime, SUMOTime newTime);
+
+
     /** @brief Set the current Time.
      *
      * This method is only for Unit Testing.
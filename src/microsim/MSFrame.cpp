@@ -50,6 +50,7 @@
 #include <microsim/MSRoute.h>
 #include <microsim/MSNet.h>
 #include <microsim/MSGlobals.h>
+#include <microsim/MSStepProfiler.h>
 #include <microsim/lcmodels/MSAbstractLaneChangeModel.h>
 #include <microsim/devices/MSDevice.h>
 #include <microsim/devices/MSDevice_Vehroutes.h>
@@ -204,6 +205,11 @@ MSFrame::fillOptions() {
     oc.doRegister("lanechange-output", new Option_FileName());
     oc.addDescription("lanechange-output", "Output", "Record lane changes and their motivations for all vehicles into FILE");
 
+#ifndef NO_STEP_PROFILE
+    oc.doRegister("step-profile", new Option_FileName());
+    oc.addDescription("step-profile", "Output", "Save the computation times of the phases of each simulation step into FILE");
+#endif
+
 #ifdef _DEBUG
     oc.doRegister("movereminder-output", new Option_FileName());
     oc.addDescription("movereminder-output", "Output", "Save movereminder states of selected vehicles into FILE");
@@ -286,6 +292,9 @@ MSFrame::fillOptions() {
     oc.doRegister("eager-insert", new Option_Bool(false));
     oc.addDescription("eager-insert", "Processing", "Whether each vehicle is checked separately for insertion on an edge");
 
+    oc.doRegister("lane-insert-once", new Option_Bool(false));
+    oc.addDescription("lane-insert-once", "Processing", "Whether vehicles with a given departure lane skip only that lane (instead of the whole edge) after an insertion on it failed in the same step");
+
     oc.doRegister("random-depart-offset", new Option_String("0", "TIME"));
     oc.addDescription("random-depart-offset", "Processing", "Each vehicle receives a random offset to its depart value drawn uniformly from [0, TIME]");
 
@@ -408,6 +417,9 @@ MSFrame::fillOptions() {
     oc.doRegister("window-size", new Option_String());
     oc.addDescription("window-size", "GUI Only", "Create initial window with the given x,y size");
 
+    oc.doRegister("gui-benchmark", new Option_Integer(0));
+    oc.addDescription("gui-benchmark", "GUI Only", "Draw the first view INT times after loading and report the drawing times (use with gui-settings-file for a fixed viewport)");
+
 #ifdef HAVE_OSG
     oc.doRegister("osg-view", new Option_Bool(false));
     oc.addDescription("osg-view", "GUI Only", "Start with an OpenSceneGraph view instead of the regular 2D view");
@@ -435,6 +447,10 @@ MSFrame::buildStreams() {
     OutputDevice::createDeviceByOption("link-output", "link-output");
     OutputDevice::createDeviceByOption("bt-output", "bt-output");
     OutputDevice::createDeviceByOption("lanechange-output", "lanechanges");
+#ifndef NO_STEP_PROFILE
+    OutputDevice::createDeviceByOption("step-profile", "step-profile");
+#endif
+    MSStepProfiler::init();
 
 #ifdef _DEBUG
     OutputDevice::createDeviceByOption("movereminder-output", "movereminder-output");
@@ -472,6 +488,10 @@ MSFrame::checkOptions() {
         WRITE_ERROR("You can either restart or quit on end.");
         ok = false;
     }
+    if (oc.getInt("gui-benchmark") < 0) {
+        WRITE_ERROR("The number of frames to draw for the benchmark must not be negative.");
+        ok = false;
+    }
     if (oc.getBool("meso-junction-control.limited") && !oc.getBool("meso-junction-control")) {
         oc.set("meso-junction-control", "true");
     }
@@ -36,6 +36,7 @@
 #include <algorithm>
 #include <cassert>
 #include <iterator>
+#include <utils/common/RandHelper.h>
 #include <microsim/devices/MSDevice_Routing.h>
 #include "MSGlobals.h"
 #include "MSInsertionControl.h"
@@ -55,10 +56,12 @@
 MSInsertionControl::MSInsertionControl(MSVehicleControl& vc,
                                        SUMOTime maxDepartDelay,
                                        bool checkEdgesOnce,
+                                       bool checkLanesOnce,
                                        int maxVehicleNumber) :
     myVehicleControl(vc),
     myMaxDepartDelay(maxDepartDelay),
     myCheckEdgesOnce(checkEdgesOnce),
+    myCheckLanesOnce(checkLanesOnce),
     myMaxVehicleNumber(maxVehicleNumber),
     myPendingEmitsUpdateTime(SUMOTime_MIN) {
 }
@@ -85,6 +88,7 @@ MSInsertionControl::add(SUMOVehicleParameter* const pars) {
     Flow flow;
     flow.pars = pars;
     flow.index = 0;
+    flow.randomStream = RandHelper::getStreamID(pars->id);
     myFlows.push_back(flow);
     myFlowIDs.insert(pars->id);
     return true;
@@ -108,7 +112,7 @@ MSInsertionControl::emitVehicles(SUMOTime time) {
     // go through the list of previously refused vehicles, first
     MSVehicleContainer::VehicleVector::const_iterator veh;
     for (veh = myPendingEmits.begin(); veh != myPendingEmits.end(); veh++) {
-        if (havePreChecked && (myEmitCandidates.count(*veh) == 0)) {
+        if (havePreChecked && !std::binary_search(myEmitCandidates.begin(), myEmitCandidates.end(), *veh)) {
             refusedEmits.push_back(*veh);
         } else {
             numEmitted += tryInsert(time, *veh, refusedEmits);
@@ -129,7 +133,7 @@ MSInsertionControl::tryInsert(SUMOTime time, SUMOVehicle* veh,
         return 1;
     }
     if ((myMaxVehicleNumber < 0 || (int)MSNet::getInstance()->getVehicleControl().getRunningVehicleNo() < myMaxVehicleNumber)
-            && (!myCheckEdgesOnce || edge.getLastFailedInsertionTime() != time)
+            && !skipInsertion(*veh, time)
             && edge.insertVehicle(*veh, time)) {
         // Successful insertion
         return 1;
@@ -148,11 +152,40 @@ MSInsertionControl::tryInsert(SUMOTime time, SUMOVehicle* veh,
         // let the vehicle wait one step, we'll retry then
         refusedEmits.push_back(veh);
     }
-    edge.setLastFailedInsertionTime(time);
+    const MSLane* const lane = getCheckedDepartLane(*veh);
+    if (lane != 0) {
+        // only this lane is blocked, vehicles for the other lanes of the edge are still tried
+        if (lane->getNumericalID() >= (int)myLastFailedLaneInsertion.size()) {
+            myLastFailedLaneInsertion.resize(MSLane::dictSize(), -1);
+        }
+        myLastFailedLaneInsertion[lane->getNumericalID()] = time;
+    } else {
+        edge.setLastFailedInsertionTime(time);
+    }
     return 0;
 }
 
 
+const MSLane*
+MSInsertionControl::getCheckedDepartLane(const SUMOVehicle& veh) const {
+    if (!myCheckLanesOnce || MSGlobals::gUseMesoSim || veh.getParameter().departLaneProcedure != DEPART_LANE_GIVEN) {
+        return 0;
+    }
+    const std::vector<MSLane*>& lanes = veh.getEdge()->getLanes();
+    return veh.getParameter().departLane < (int)lanes.size() ? lanes[veh.getParameter().departLane] : 0;
+}
+
+
+bool
+MSInsertionControl::skipInsertion(const SUMOVehicle& veh, SUMOTime time) const {
+    const MSLane* const lane = getCheckedDepartLane(veh);
+    if (lane != 0) {
+        return lane->getNumericalID() < (int)myLastFailedLaneInsertion.size() && myLastFailedLaneInsertion[lane->getNumericalID()] == time;
+    }
+    return myCheckEdgesOnce && veh.getEdge()->getLastFailedInsertionTime() == time;
+}
+
+
 void
 MSInsertionControl::checkCandidates(SUMOTime time, const bool preCheck) {
     while (myAllVeh.anyWaitingBefore(time + DELTA_T)) {
@@ -161,12 +194,13 @@ MSInsertionControl::checkCandidates(SUMOTime time, const bool preCheck) {
         myAllVeh.pop();
     }
     if (preCheck) {
+        myEmitCandidates.clear();
         MSVehicleContainer::VehicleVector::const_iterator veh;
         for (veh = myPendingEmits.begin(); veh != myPendingEmits.end(); veh++) {
             SUMOVehicle* const v = *veh;
             const MSEdge* const edge = v->getEdge();
-            if ((!myCheckEdgesOnce || edge->getLastFailedInsertionTime() != time) && edge->insertVehicle(*v, time, true)) {
-                myEmitCandidates.insert(v);
+            if (!skipInsertion(*v, time) && edge->insertVehicle(*v, time, true)) {
+                myEmitCandidates.push_back(v);
             } else {
                 MSDevice_Routing* dev = static_cast<MSDevice_Routing*>(v->getDevice(typeid(MSDevice_Routing)));
                 if (dev != 0) {
@@ -174,6 +208,8 @@ MSInsertionControl::checkCandidates(SUMOTime time, const bool preCheck) {
                 }
             }
         }
+        // sorted for lookup in emitVehicles; the insertion order is still given by myPendingEmits
+        std::sort(myEmitCandidates.begin(), myEmitCandidates.end());
     }
 }
 
@@ -191,7 +227,7 @@ MSInsertionControl::determineCandidates(SUMOTime time) {
                     && pars->depart < time + DELTA_T
                     && pars->repetitionEnd > time
                     // only call rand if all other conditions are met
-                    && RandHelper::rand() < (pars->repetitionProbability * TS))
+                    && RandHelper::randCounterBased(i->randomStream, (unsigned long long)time) < (pars->repetitionProbability * TS))
               ) {
             tryEmitByProb = false; // only emit one per step
             SUMOVehicleParameter* newPars = new SUMOVehicleParameter(*pars);
@@ -281,28 +317,55 @@ MSInsertionControl::clearPendingVehicles(std::string& route) {
 }
 
 
+void
+MSInsertionControl::clearState() {
+    for (std::vector<Flow>::iterator i = myFlows.begin(); i != myFlows.end(); ++i) {
+        delete(i->pars);
+    }
+    myFlows.clear();
+    myFlowIDs.clear();
+    while (!myAllVeh.isEmpty()) {
+        myAllVeh.pop();
+    }
+    myPendingEmits.clear();
+    myEmitCandidates.clear();
+    myAbortedEmits.clear();
+    myLastFailedLaneInsertion.clear();
+    myPendingEmitsUpdateTime = SUMOTime_MIN;
+}
+
+
 int
 MSInsertionControl::getPendingEmits(const MSLane* lane) {
     if (MSNet::getInstance()->getCurrentTimeStep() > myPendingEmitsUpdateTime) {
         // updated pending emits (only once per time step)
-        myPendingEmitsForLane.clear();
+        myPendingEmitsForLane.assign(MSLane::dictSize(), 0);
         for (MSVehicleContainer::VehicleVector::const_iterator veh = myPendingEmits.begin(); veh != myPendingEmits.end(); ++veh) {
             const MSLane* lane = (*veh)->getLane();
             if (lane != 0) {
-                myPendingEmitsForLane[lane]++;
+                countPendingEmit(lane);
             } else {
                 // no (tentative) departLane was set, increase count for all
                 // lanes of the depart edge
                 const MSEdge* edge = (*veh)->getEdge();
                 const std::vector<MSLane*>& lanes = edge->getLanes();
                 for (std::vector<MSLane*>::const_iterator i = lanes.begin(); i != lanes.end(); ++i) {
-                    myPendingEmitsForLane[*i]++;
+                    countPendingEmit(*i);
                 }
             }
         }
         myPendingEmitsUpdateTime = MSNet::getInstance()->getCurrentTimeStep();
     }
-    return myPendingEmitsForLane[lane];
+    return lane->getNumericalID() < (int)myPendingEmitsForLane.size() ? myPendingEmitsForLane[lane->getNumericalID()] : 0;
+}
+
+
+void
+MSInsertionControl::countPendingEmit(const MSLane* lane) {
+    if (lane->getNumericalID() >= (int)myPendingEmitsForLane.size()) {
+        myPendingEmitsForLane.resize(lane->getNumericalID() + 1, 0);
+    }
+    myPendingEmitsForLane[lane->getNumericalID()]++;
 }
 
 /****************************************************************************/
@@ -71,9 +71,10 @@ public:
      * @param[in] vc The assigned vehicle control (needed for vehicle re-insertion and deletion)
      * @param[in] maxDepartDelay Vehicles waiting for insertion longer than this time are deleted (-1: no deletion)
      * @param[in] checkEdgesOnce Whether an edge on which a vehicle could not depart should be ignored in the same step
+     * @param[in] checkLanesOnce Whether a given departure lane on which a vehicle could not depart should be ignored in the same step
      * @param[in] maxVehicleNumber The maximum number of vehicles that should not be exceeded
      */
-    MSInsertionControl(MSVehicleControl& vc, SUMOTime maxDepartDelay, bool checkEdgesOnce, int maxVehicleNumber);
+    MSInsertionControl(MSVehicleControl& vc, SUMOTime maxDepartDelay, bool checkEdgesOnce, bool checkLanesOnce, int maxVehicleNumber);
 
 
     /// @brief Destructor.
@@ -143,6 +144,13 @@ public:
     void clearPendingVehicles(std::string& route);
 
 
+    /** @brief Forgets all vehicles and flows waiting for insertion
+     *
+     * The vehicles are not deleted (this is done by the vehicle control).
+     */
+    void clearState();
+
+
     /** @brief Checks for all vehicles whether they can be emitted
      *
      * @param[in] time The current simulation time
@@ -179,6 +187,22 @@ private:
     void checkCandidates(SUMOTime time, const bool preCheck);
 
 
+    /// @brief increases the number of pending emits for the given lane
+    void countPendingEmit(const MSLane* lane);
+
+
+    /** @brief Returns the departure lane if it is given and checked only once per step
+     *
+     * @param[in] veh The vehicle to insert
+     * @return The given departure lane, 0 if the lane is chosen on insertion or lanes are not checked once
+     */
+    const MSLane* getCheckedDepartLane(const SUMOVehicle& veh) const;
+
+
+    /// @brief Returns whether the insertion of the vehicle is skipped because its lane or edge refused a vehicle in this step
+    bool skipInsertion(const SUMOVehicle& veh, SUMOTime time) const;
+
+
 private:
     /// @brief The assigned vehicle control (needed for vehicle re-insertion and deletion)
     MSVehicleControl& myVehicleControl;
@@ -189,8 +213,8 @@ private:
     /// @brief Buffers for vehicles that could not be inserted
     MSVehicleContainer::VehicleVector myPendingEmits;
 
-    /// @brief Buffer for vehicles that may be inserted in the current step
-    std::set<SUMOVehicle*> myEmitCandidates;
+    /// @brief Buffer for vehicles that may be inserted in the current step (sorted by address)
+    std::vector<SUMOVehicle*> myEmitCandidates;
 
     /// @brief Set of vehicles which shall not be inserted anymore
     std::set<SUMOVehicle*> myAbortedEmits;
@@ -203,6 +227,8 @@ private:
         SUMOVehicleParameter* pars;
         /// @brief the running index
         int index;
+        /// @brief The id of the flow's random stream (drawn once per step for probabilistic flows)
+        unsigned long long randomStream;
     };
 
     /// @brief Container for periodical vehicle parameters
@@ -217,14 +243,20 @@ private:
     /// @brief Whether an edge on which a vehicle could not depart should be ignored in the same step
     bool myCheckEdgesOnce;
 
+    /// @brief Whether a given departure lane on which a vehicle could not depart should be ignored in the same step
+    bool myCheckLanesOnce;
+
+    /// @brief The last time a vehicle could not be inserted on a given departure lane (by numerical id)
+    std::vector<SUMOTime> myLastFailedLaneInsertion;
+
     /// @brief Storage for maximum vehicle number
     int myMaxVehicleNumber;
 
     /// @brief Last time at which pending emits for each edge where counted
     SUMOTime myPendingEmitsUpdateTime;
 
-    /// @brief the number of pending emits for each edge in the current time step
-    std::map<const MSLane*, int> myPendingEmitsForLane;
+    /// @brief the number of pending emits for each lane (by numerical id) in the current time step
+    std::vector<int> myPendingEmitsForLane;
 
 
 private:
@@ -87,6 +87,7 @@
 MSLane::DictType MSLane::myDict;
 MSLane::CollisionAction MSLane::myCollisionAction(MSLane::COLLISION_ACTION_TELEPORT);
 bool MSLane::myCheckJunctionCollisions(false);
+unsigned int MSLane::myGlobalOccupancyVersion(0);
 
 // ===========================================================================
 // internal class method definitions
@@ -166,16 +167,25 @@ MSLane::MSLane(const std::string& id, SUMOReal maxSpeed, SUMOReal length, MSEdge
     myPermissions(permissions),
     myOriginalPermissions(permissions),
     myLogicalPredecessorLane(0),
-    myBruttoVehicleLengthSum(0), myNettoVehicleLengthSum(0),
+    myBruttoVehicleLengthSum(0), myNettoVehicleLengthSum(0), mySpeedSum(0),
     myLeaderInfo(this, 0, 0),
     myFollowerInfo(this, 0, 0),
     myLeaderInfoTmp(this, 0, 0),
+    myPlanMoveLeaders(this, 0, 0),
     myLeaderInfoTime(SUMOTime_MIN),
     myFollowerInfoTime(SUMOTime_MIN),
+    myFollowerFrontInfo(this, 0, 0),
+    myFollowerFrontInfoTime(SUMOTime_MIN),
+    myOccupancyVersion(0),
+    myLeaderInfoVersion(0),
+    myFollowerInfoVersion(0),
+    myFollowerFrontInfoVersion(0),
     myLengthGeometryFactor(MAX2(POSITION_EPS, myShape.length()) / myLength), // factor should not be 0
     myRightSideOnEdge(0), // initialized in MSEdge::initialize
     myRightmostSublane(0) { // initialized in MSEdge::initialize
     myRestrictions = MSNet::getInstance()->getRestrictions(edge->getEdgeType());
+    // positions on the lane are looked up for every vehicle and step
+    myShape.buildLengthIndex();
 }
 
 
@@ -217,6 +227,7 @@ MSLane::setPartialOccupation(MSVehicle* v) {
 #endif
     // XXX update occupancy here?
     myPartialVehicles.push_back(v);
+    occupancyChanged();
     return myLength;
 }
 
@@ -231,6 +242,7 @@ MSLane::resetPartialOccupation(MSVehicle* v) {
     for (VehCont::iterator i = myPartialVehicles.begin(); i != myPartialVehicles.end(); ++i) {
         if (v == *i) {
             myPartialVehicles.erase(i);
+            occupancyChanged();
             // XXX update occupancy here?
             //std::cout << "    removed from myPartialVehicles\n";
             return;
@@ -252,8 +264,10 @@ MSLane::incorporateVehicle(MSVehicle* veh, SUMOReal pos, SUMOReal speed, SUMORea
     } else {
         myVehicles.insert(at, veh);
     }
+    occupancyChanged();
     myBruttoVehicleLengthSum += veh->getVehicleType().getLengthWithGap();
     myNettoVehicleLengthSum += veh->getVehicleType().getLength();
+    mySpeedSum += veh->getSpeed();
     myEdge->markDelayed();
     if (wasInactive) {
         MSNet::getInstance()->getEdgeControl().gotActive(this);
@@ -378,7 +392,7 @@ MSLane::getDepartSpeed(const MSVehicle& veh, bool& patchSpeed) {
             patchSpeed = false;
             break;
         case DEPART_SPEED_RANDOM:
-            speed = RandHelper::rand(getVehicleMaxSpeed(&veh));
+            speed = veh.randStream() * getVehicleMaxSpeed(&veh);
             patchSpeed = true; // @todo check
             break;
         case DEPART_SPEED_MAX:
@@ -412,15 +426,15 @@ MSLane::insertVehicle(MSVehicle& veh) {
             }
             break;
         case DEPART_POS_RANDOM:
-            pos = RandHelper::rand(getLength());
+            pos = veh.randStream() * getLength();
             break;
         case DEPART_POS_RANDOM_FREE: {
             for (int i = 0; i < 10; i++) {
                 // we will try some random positions ...
-                pos = RandHelper::rand(getLength());
+                pos = veh.randStream() * getLength();
                 if (pars.departPosLatProcedure == DEPART_POSLAT_RANDOM ||
                         pars.departPosLatProcedure == DEPART_POSLAT_RANDOM_FREE) {
-                    posLat = RandHelper::rand(getWidth() - veh.getVehicleType().getWidth()) - getWidth() * 0.5 + veh.getVehicleType().getWidth() * 0.5;
+                    posLat = veh.randStream() * (getWidth() - veh.getVehicleType().getWidth()) - getWidth() * 0.5 + veh.getVehicleType().getWidth() * 0.5;
                 }
                 if (isInsertionSuccess(&veh, speed, pos, posLat, patchSpeed, MSMoveReminder::NOTIFICATION_DEPARTED)) {
                     return true;
@@ -446,12 +460,12 @@ MSLane::insertVehicle(MSVehicle& veh) {
             posLat = pars.departPosLat;
             break;
         case DEPART_POSLAT_RANDOM:
-            posLat = RandHelper::rand(getWidth() - veh.getVehicleType().getWidth()) - getWidth() * 0.5 + veh.getVehicleType().getWidth() * 0.5;
+            posLat = veh.randStream() * (getWidth() - veh.getVehicleType().getWidth()) - getWidth() * 0.5 + veh.getVehicleType().getWidth() * 0.5;
             break;
         case DEPART_POSLAT_RANDOM_FREE: {
             for (int i = 0; i < 10; i++) {
                 // we will try some random positions ...
-                posLat = RandHelper::rand(getWidth()) - getWidth() * 0.5;
+                posLat = veh.randStream() * getWidth() - getWidth() * 0.5;
                 if (isInsertionSuccess(&veh, speed, pos, posLat, patchSpeed, MSMoveReminder::NOTIFICATION_DEPARTED)) {
                     return true;
                 }
@@ -832,8 +846,10 @@ MSLane::safeInsertionSpeed(const MSVehicle* veh, const MSLeaderInfo& leaders, SU
 // ------ Handling vehicles lapping into lanes ------
 const MSLeaderInfo&
 MSLane::getLastVehicleInformation(const MSVehicle* ego, SUMOReal latOffset, SUMOReal minPos, bool allowCached) const {
-    if (myLeaderInfoTime < MSNet::getInstance()->getCurrentTimeStep() || ego != 0 || minPos > 0 || !allowCached) {
-        myLeaderInfoTmp = MSLeaderInfo(this, ego, latOffset);
+    const bool cacheValid = myLeaderInfoTime == MSNet::getInstance()->getCurrentTimeStep()
+                            && (allowCached || myLeaderInfoVersion == getOccupancyVersion());
+    if (!cacheValid || ego != 0 || minPos > 0) {
+        myLeaderInfoTmp.reset(this, ego, latOffset);
         AnyVehicleIterator last = anyVehiclesBegin();
         int freeSublanes = 1; // number of sublanes for which no leader was found
         //if (ego->getID() == "disabled" && SIMTIME == 58) {
@@ -860,6 +876,7 @@ MSLane::getLastVehicleInformation(const MSVehicle* ego, SUMOReal latOffset, SUMO
         if (ego == 0 && minPos == 0) {
             // update cached value
             myLeaderInfoTime = MSNet::getInstance()->getCurrentTimeStep();
+            myLeaderInfoVersion = getOccupancyVersion();
             myLeaderInfo = myLeaderInfoTmp;
         }
 #ifdef DEBUG_PLAN_MOVE
@@ -883,9 +900,13 @@ MSLane::getLastVehicleInformation(const MSVehicle* ego, SUMOReal latOffset, SUMO
 
 const MSLeaderInfo&
 MSLane::getFirstVehicleInformation(const MSVehicle* ego, SUMOReal latOffset, bool onlyFrontOnLane, SUMOReal maxPos, bool allowCached) const {
-    if (myFollowerInfoTime < MSNet::getInstance()->getCurrentTimeStep() || ego != 0 || maxPos < myLength || !allowCached || onlyFrontOnLane) {
-        // XXX separate cache for onlyFrontOnLane = true
-        myLeaderInfoTmp = MSLeaderInfo(this, ego, latOffset);
+    const SUMOTime now = MSNet::getInstance()->getCurrentTimeStep();
+    // the value for onlyFrontOnLane was never reused within a step before, so it is only reused while the vehicles do not change
+    const bool cacheValid = onlyFrontOnLane
+                            ? myFollowerFrontInfoTime == now && myFollowerFrontInfoVersion == getOccupancyVersion()
+                            : myFollowerInfoTime == now && (allowCached || myFollowerInfoVersion == getOccupancyVersion());
+    if (!cacheValid || ego != 0 || maxPos < myLength) {
+        myLeaderInfoTmp.reset(this, ego, latOffset);
         AnyVehicleIterator first = anyVehiclesUpstreamBegin();
         int freeSublanes = 1; // number of sublanes for which no leader was found
         const MSVehicle* veh = *first;
@@ -910,8 +931,15 @@ MSLane::getFirstVehicleInformation(const MSVehicle* ego, SUMOReal latOffset, boo
         }
         if (ego == 0 && maxPos == std::numeric_limits<SUMOReal>::max()) {
             // update cached value
-            myFollowerInfoTime = MSNet::getInstance()->getCurrentTimeStep();
-            myFollowerInfo = myLeaderInfoTmp;
+            if (onlyFrontOnLane) {
+                myFollowerFrontInfoTime = now;
+                myFollowerFrontInfoVersion = getOccupancyVersion();
+                myFollowerFrontInfo = myLeaderInfoTmp;
+            } else {
+                myFollowerInfoTime = now;
+                myFollowerInfoVersion = getOccupancyVersion();
+                myFollowerInfo = myLeaderInfoTmp;
+            }
         }
 #ifdef DEBUG_PLAN_MOVE
         //if (DEBUG_COND2(ego)) std::cout << SIMTIME
@@ -928,7 +956,7 @@ MSLane::getFirstVehicleInformation(const MSVehicle* ego, SUMOReal latOffset, boo
 #endif
         return myLeaderInfoTmp;
     }
-    return myFollowerInfo;
+    return onlyFrontOnLane ? myFollowerFrontInfo : myFollowerInfo;
 }
 
 
@@ -937,7 +965,8 @@ void
 MSLane::planMovements(SUMOTime t) {
     assert(myVehicles.size() != 0);
     SUMOReal cumulatedVehLength = 0.;
-    MSLeaderInfo ahead(this);
+    MSLeaderInfo& ahead = myPlanMoveLeaders;
+    ahead.reset(this);
     // iterate over myVehicles and myPartialVehicles merge-sort style
     VehCont::reverse_iterator veh = myVehicles.rbegin();
     VehCont::reverse_iterator vehPart = myPartialVehicles.rbegin();
@@ -1011,17 +1040,38 @@ MSLane::detectCollisions(SUMOTime timestep, const std::string& stage) {
         // XXX for efficiency, all lanes of an edge should be checked together
         // (lanechanger-style)
 
-        // XXX quick hack: check each in myVehicles against all others
+        // collect all vehicles touching this lane in downstream order
+        std::vector<MSVehicle*> all;
+        std::vector<SUMOReal> allPos;
+        SUMOReal maxLength = 0;
+        bool sorted = true;
+        for (AnyVehicleIterator veh2 = anyVehiclesBegin(); veh2 != anyVehiclesEnd(); ++veh2) {
+            MSVehicle* lead = (MSVehicle*)*veh2;
+            const SUMOReal pos = lead->getPositionOnLane(this);
+            sorted &= allPos.size() == 0 || allPos.back() <= pos;
+            all.push_back(lead);
+            allPos.push_back(pos);
+            maxLength = MAX2(maxLength, lead->getVehicleType().getLength());
+        }
+        // if the vehicles are sorted, only those with their front between the
+        // front of follow and the farthest position a back overlapping follow's
+        // front (and minGap) may belong to need to be checked
         for (VehCont::iterator veh = myVehicles.begin(); veh != myVehicles.end(); ++veh) {
             MSVehicle* follow = *veh;
-            for (AnyVehicleIterator veh2 = anyVehiclesBegin(); veh2 != anyVehiclesEnd(); ++veh2) {
-                MSVehicle* lead = (MSVehicle*)*veh2;
+            const SUMOReal followPos = follow->getPositionOnLane();
+            const SUMOReal maxLeadPos = followPos + follow->getVehicleType().getMinGap() + maxLength;
+            const int first = sorted ? (int)(std::lower_bound(allPos.begin(), allPos.end(), followPos) - allPos.begin()) : 0;
+            for (int i = first; i < (int)all.size(); ++i) {
+                MSVehicle* lead = all[i];
                 if (lead == follow) {
                     continue;
                 }
-                if (lead->getPositionOnLane(this) < follow->getPositionOnLane()) {
+                if (allPos[i] < followPos) {
                     continue;
                 }
+                if (sorted && allPos[i] > maxLeadPos) {
+                    break;
+                }
                 if (detectCollisionBetween(timestep, stage, follow, lead, toRemove, toTeleport)) {
                     break;
                 }
@@ -1029,7 +1079,7 @@ MSLane::detectCollisions(SUMOTime timestep, const std::string& stage) {
             if (follow->getLaneChangeModel().getShadowLane() != 0) {
                 // check whether follow collides on the shadow lane
                 const MSLane* shadowLane = follow->getLaneChangeModel().getShadowLane();
-                MSLeaderInfo ahead = shadowLane->getLastVehicleInformation(follow,
+                const MSLeaderInfo& ahead = shadowLane->getLastVehicleInformation(follow,
                                      getRightSideOnEdge() - shadowLane->getRightSideOnEdge(),
                                      follow->getPositionOnLane());
                 for (int i = 0; i < ahead.numSublanes(); ++i) {
@@ -1046,22 +1096,38 @@ MSLane::detectCollisions(SUMOTime timestep, const std::string& stage) {
         assert(myLinks.size() == 1);
         //std::cout << SIMTIME << " checkJunctionCollisions " << getID() << "\n";
         const std::vector<const MSLane*>& foeLanes = myLinks.front()->getFoeLanes();
-        for (VehCont::iterator veh = myVehicles.begin(); veh != myVehicles.end(); ++veh) {
+        // the bounding boxes of the vehicles on the foe lanes are computed once for all colliders
+        std::vector<const MSVehicle*> victims;
+        std::vector<PositionVector> victimBoxes;
+        std::vector<Boundary> victimBoundaries;
+        for (std::vector<const MSLane*>::const_iterator it = foeLanes.begin(); it != foeLanes.end(); ++it) {
+            const MSLane* foeLane = *it;
+            //std::cout << "     foeLane " << foeLane->getID() << "\n";
+            MSLane::AnyVehicleIterator end = foeLane->anyVehiclesEnd();
+            for (MSLane::AnyVehicleIterator it_veh = foeLane->anyVehiclesBegin(); it_veh != end; ++it_veh) {
+                const MSVehicle* victim = *it_veh;
+                victims.push_back(victim);
+                victimBoxes.push_back(victim->getBoundingBox());
+                victimBoundaries.push_back(victimBoxes.back().getBoxBoundary());
+            }
+        }
+        for (VehCont::iterator veh = myVehicles.begin(); veh != myVehicles.end() && victims.size() > 0; ++veh) {
             const MSVehicle* collider = *veh;
             //std::cout << "   collider " << collider->getID() << "\n";
-            PositionVector colliderBoundary = collider->getBoundingBox();
-            for (std::vector<const MSLane*>::const_iterator it = foeLanes.begin(); it != foeLanes.end(); ++it) {
-                const MSLane* foeLane = *it;
-                //std::cout << "     foeLane " << foeLane->getID() << "\n";
-                MSLane::AnyVehicleIterator end = foeLane->anyVehiclesEnd();
-                for (MSLane::AnyVehicleIterator it_veh = foeLane->anyVehiclesBegin(); it_veh != end; ++it_veh) {
-                    MSVehicle* victim = (MSVehicle*)*it_veh;
-                    //std::cout << "             victim " << victim->getID() << "\n";
-                    if (colliderBoundary.overlapsWith(victim->getBoundingBox())) {
-                        // make a detailed check
-                        if (collider->getBoundingPoly().overlapsWith(victim->getBoundingPoly())) {
-                            handleCollisionBetween(timestep, stage, collider, victim, -1, 0, toRemove, toTeleport);
-                        }
+            const PositionVector colliderBoundary = collider->getBoundingBox();
+            const Boundary colliderBox = colliderBoundary.getBoxBoundary();
+            for (int i = 0; i < (int)victims.size(); ++i) {
+                const Boundary& victimBox = victimBoundaries[i];
+                //std::cout << "             victim " << victims[i]->getID() << "\n";
+                // cheap check of the axis-aligned boxes first
+                if (colliderBox.xmax() < victimBox.xmin() || victimBox.xmax() < colliderBox.xmin()
+                        || colliderBox.ymax() < victimBox.ymin() || victimBox.ymax() < colliderBox.ymin()) {
+                    continue;
+                }
+                if (colliderBoundary.overlapsWith(victimBoxes[i])) {
+                    // make a detailed check
+                    if (collider->getBoundingPoly().overlapsWith(victims[i]->getBoundingPoly())) {
+                        handleCollisionBetween(timestep, stage, collider, victims[i], -1, 0, toRemove, toTeleport);
                     }
                 }
             }
@@ -1185,6 +1251,7 @@ MSLane::handleCollisionBetween(SUMOTime timestep, const std::string& stage, cons
 
 bool
 MSLane::executeMovements(SUMOTime t, std::vector<MSLane*>& lanesWithVehiclesToIntegrate) {
+    occupancyChanged();
     // iterate over vehicles in reverse so that move reminders will be called in the correct order
     for (VehCont::reverse_iterator i = myVehicles.rbegin(); i != myVehicles.rend();) {
         MSVehicle* veh = *i;
@@ -1263,6 +1330,11 @@ MSLane::executeMovements(SUMOTime t, std::vector<MSLane*>& lanesWithVehiclesToIn
             } // else look for a (waiting) vehicle that isn't stopped?
         }
     }
+    // all remaining vehicles have moved, so their speeds are summed anew (this also discards rounding errors)
+    mySpeedSum = 0;
+    for (VehCont::const_iterator i = myVehicles.begin(); i != myVehicles.end(); ++i) {
+        mySpeedSum += (*i)->getSpeed();
+    }
     if (MSGlobals::gLateralResolution > 0) {
         // trigger sorting of vehicles as their order may have changed
         lanesWithVehiclesToIntegrate.push_back(this);
@@ -1362,6 +1434,7 @@ bool
 MSLane::integrateNewVehicle(SUMOTime) {
     //std::cout << SIMTIME << " integrateNewVehicle lane=" << getID() << "\n";
     bool wasInactive = myVehicles.size() == 0;
+    occupancyChanged();
     sort(myVehBuffer.begin(), myVehBuffer.end(), vehicle_position_sorter(this));
     for (std::vector<MSVehicle*>::const_iterator i = myVehBuffer.begin(); i != myVehBuffer.end(); ++i) {
         MSVehicle* veh = *i;
@@ -1369,6 +1442,7 @@ MSLane::integrateNewVehicle(SUMOTime) {
         myVehicles.insert(myVehicles.begin(), veh);
         myBruttoVehicleLengthSum += veh->getVehicleType().getLengthWithGap();
         myNettoVehicleLengthSum += veh->getVehicleType().getLength();
+        mySpeedSum += veh->getSpeed();
         //if (true) std::cout << SIMTIME << " integrateNewVehicle lane=" << getID() << " veh=" << veh->getID() << " (on lane " << veh->getLane()->getID() << ") into lane=" << getID() << " myBrutto=" << myBruttoVehicleLengthSum << "\n";
         myEdge->markDelayed();
     }
@@ -1387,6 +1461,7 @@ void
 MSLane::sortPartialVehicles() {
     if (myPartialVehicles.size() > 1) {
         sort(myPartialVehicles.begin(), myPartialVehicles.end(), vehicle_natural_position_sorter(this));
+        occupancyChanged();
     }
 }
 
@@ -1533,6 +1608,7 @@ MSLane::swapAfterLaneChange(SUMOTime) {
     //if (getID() == "disabled_lane") std::cout << SIMTIME << " swapAfterLaneChange lane=" << getID() << " myVehicles=" << toString(myVehicles) << " myTmpVehicles=" << toString(myTmpVehicles) << "\n";
     myVehicles = myTmpVehicles;
     myTmpVehicles.clear();
+    occupancyChanged();
     // this needs to be done after finishing lane-changing for all lanes on the
     // current edge (MSLaneChanger::updateLanes())
     sortPartialVehicles();
@@ -1548,8 +1624,10 @@ MSLane::removeVehicle(MSVehicle* remVehicle, MSMoveReminder::Notification notifi
                 remVehicle->leaveLane(notification);
             }
             myVehicles.erase(it);
+            occupancyChanged();
             myBruttoVehicleLengthSum -= remVehicle->getVehicleType().getLengthWithGap();
             myNettoVehicleLengthSum -= remVehicle->getVehicleType().getLength();
+            mySpeedSum -= remVehicle->getSpeed();
             break;
         }
     }
@@ -2014,15 +2092,19 @@ MSLane::getOutgoingLanes() const {
 
 void
 MSLane::leftByLaneChange(MSVehicle* v) {
+    occupancyChanged();
     myBruttoVehicleLengthSum -= v->getVehicleType().getLengthWithGap();
     myNettoVehicleLengthSum -= v->getVehicleType().getLength();
+    mySpeedSum -= v->getSpeed();
 }
 
 
 void
 MSLane::enteredByLaneChange(MSVehicle* v) {
+    occupancyChanged();
     myBruttoVehicleLengthSum += v->getVehicleType().getLengthWithGap();
     myNettoVehicleLengthSum += v->getVehicleType().getLength();
+    mySpeedSum += v->getSpeed();
 }
 
 
@@ -2085,14 +2167,7 @@ MSLane::getMeanSpeed() const {
     if (myVehicles.size() == 0) {
         return myMaxSpeed;
     }
-    SUMOReal v = 0;
-    const MSLane::VehCont& vehs = getVehiclesSecure();
-    for (VehCont::const_iterator i = vehs.begin(); i != vehs.end(); ++i) {
-        v += (*i)->getSpeed();
-    }
-    SUMOReal ret = v / (SUMOReal) myVehicles.size();
-    releaseVehicles();
-    return ret;
+    return mySpeedSum / (SUMOReal) myVehicles.size();
 }
 
 
@@ -2264,6 +2339,14 @@ MSLane::loadState(std::vector<std::string>& vehIds, MSVehicleControl& vc) {
 }
 
 
+void
+MSLane::clearState() {
+    myLeaderInfoTime = SUMOTime_MIN;
+    myFollowerInfoTime = SUMOTime_MIN;
+    myFollowerFrontInfoTime = SUMOTime_MIN;
+}
+
+
 MSLeaderDistanceInfo
 MSLane::getFollowersOnConsecutive(const MSVehicle* ego, bool allSublanes) const {
     // get the follower vehicle on the lane to change to
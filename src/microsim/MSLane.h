@@ -331,7 +331,8 @@ public:
      * returned. Partial occupators are included
      * @param[in] ego The vehicle for which to restrict the returned leaderInfo
      * @param[in] minPos The minimum position from which to start search for leaders
-     * @param[in] allowCached Whether the cached value may be used
+     * @param[in] allowCached Whether the value cached in this step may be used
+     *  (otherwise it is only used if the vehicles on this lane did not change since it was computed)
      * @return Information about the last vehicles
      */
     const MSLeaderInfo& getLastVehicleInformation(const MSVehicle* ego, SUMOReal latOffset, SUMOReal minPos = 0, bool allowCached = true) const;
@@ -339,6 +340,15 @@ public:
     /// @brief analogue to getLastVehicleInformation but in the upstream direction
     const MSLeaderInfo& getFirstVehicleInformation(const MSVehicle* ego, SUMOReal latOffset, bool onlyFrontOnLane, SUMOReal maxPos = std::numeric_limits<SUMOReal>::max(), bool allowCached = true) const;
 
+    /** @brief Invalidates the leader information of all lanes which is reused while their vehicles do not change
+     *
+     * Changes of single lanes are tracked by the lanes themselves. This must be
+     *  called whenever vehicles on many lanes change at once (i.e. before each simulation phase)
+     */
+    static void invalidateOccupancy() {
+        ++myGlobalOccupancyVersion;
+    }
+
     /// @}
 
 
@@ -841,6 +851,14 @@ public:
     }
 
 
+    /** @brief Returns the sum of the speeds of the vehicles on this lane
+     * @return The sum of the speeds of vehicles in the last step
+     */
+    inline SUMOReal getSpeedSum() const {
+        return mySpeedSum;
+    }
+
+
     /** @brief Returns the sum of last step CO2 emissions
      * @return CO2 emissions of vehicles on this lane during the last step
      */
@@ -952,6 +970,13 @@ public:
      * @todo What about throwing an error if something else fails (a vehicle can not be referenced)?
      */
     void loadState(std::vector<std::string>& vehIDs, MSVehicleControl& vc);
+
+    /** @brief Invalidates the cached leader and follower information
+     *
+     * Has to be called when the simulation time is reset as the caches are
+     *  considered valid for the time step they were computed in.
+     */
+    void clearState();
     /// @}
 
 
@@ -1099,6 +1124,9 @@ protected:
     /// @brief The current length of all vehicles on this lane, excluding their minGaps
     SUMOReal myNettoVehicleLengthSum;
 
+    /// @brief The sum of the speeds of all vehicles on this lane (recomputed in executeMovements)
+    SUMOReal mySpeedSum;
+
     /** The lane's Links to it's succeeding lanes and the default
         right-of-way rule, i.e. blocked or not blocked. */
     MSLinkCont myLinks;
@@ -1112,10 +1140,24 @@ protected:
 
     mutable MSLeaderInfo myLeaderInfoTmp;
 
+    /// @brief the leaders collected within planMovements (kept to reuse its memory)
+    MSLeaderInfo myPlanMoveLeaders;
+
     /// @brief time step for which myLeaderInfo was last updated
     mutable SUMOTime myLeaderInfoTime;
     /// @brief time step for which myFollowerInfo was last updated
     mutable SUMOTime myFollowerInfoTime;
+    /// @brief followers on all sublanes which have their front on this lane (cached)
+    mutable MSLeaderInfo myFollowerFrontInfo;
+    /// @brief time step for which myFollowerFrontInfo was last updated
+    mutable SUMOTime myFollowerFrontInfoTime;
+
+    /// @brief counts the changes of the vehicles touching this lane (membership, order and lateral placement)
+    unsigned int myOccupancyVersion;
+    /// @brief the occupancy version for which myLeaderInfo, myFollowerInfo and myFollowerFrontInfo were computed
+    mutable unsigned int myLeaderInfoVersion;
+    mutable unsigned int myFollowerInfoVersion;
+    mutable unsigned int myFollowerFrontInfoVersion;
 
     /// @brief precomputed myShape.length / myLength
     const SUMOReal myLengthGeometryFactor;
@@ -1145,6 +1187,19 @@ private:
     static CollisionAction myCollisionAction;
     static bool myCheckJunctionCollisions;
 
+    /// @brief counts the changes affecting the vehicles on all lanes, @see invalidateOccupancy
+    static unsigned int myGlobalOccupancyVersion;
+
+    /// @brief registers a change of the vehicles touching this lane
+    void occupancyChanged() {
+        ++myOccupancyVersion;
+    }
+
+    /// @brief returns a value which changes whenever the vehicles touching this lane change
+    unsigned int getOccupancyVersion() const {
+        return myOccupancyVersion + myGlobalOccupancyVersion;
+    }
+
     /**
      * @class vehicle_position_sorter
      * @brief Sorts vehicles by their position (descending)
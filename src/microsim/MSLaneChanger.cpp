@@ -374,6 +374,7 @@ MSLaneChanger::continueChange(MSVehicle* vehicle, ChangerIt& from) {
         shadow->hoppedVeh = vehicle;
     }
     vehicle->myAngle = vehicle->computeAngle();
+    registerLateralMove(vehicle, from->lane);
 
 #ifdef DEBUG_CONTINUE_CHANGE
     if (DEBUG_COND) {
@@ -543,6 +544,25 @@ MSLaneChanger::getRealFollower(const ChangerIt& target) const {
 }
 
 
+void
+MSLaneChanger::registerLateralMove(MSVehicle* vehicle, MSLane* source) {
+    source->occupancyChanged();
+    vehicle->getLane()->occupancyChanged();
+    const std::vector<MSLane*>& furtherLanes = vehicle->getFurtherLanes();
+    for (std::vector<MSLane*>::const_iterator it = furtherLanes.begin(); it != furtherLanes.end(); ++it) {
+        (*it)->occupancyChanged();
+    }
+    const MSAbstractLaneChangeModel& lcm = vehicle->getLaneChangeModel();
+    if (lcm.getShadowLane() != 0) {
+        lcm.getShadowLane()->occupancyChanged();
+    }
+    const std::vector<MSLane*>& shadowFurtherLanes = lcm.getShadowFurtherLanes();
+    for (std::vector<MSLane*>::const_iterator it = shadowFurtherLanes.begin(); it != shadowFurtherLanes.end(); ++it) {
+        (*it)->occupancyChanged();
+    }
+}
+
+
 MSVehicle*
 MSLaneChanger::getCloserFollower(const SUMOReal maxPos, MSVehicle* follow1, MSVehicle* follow2) {
     if (follow1 == 0 || follow1->getPositionOnLane() > maxPos) {
@@ -188,6 +188,9 @@ protected:
     /// @brief whether changing to the lane in the given direction should be considered
     bool mayChange(int direction) const;
 
+    /// @brief informs all lanes touched by the vehicle (and the given source lane) about its lateral movement
+    static void registerLateralMove(MSVehicle* vehicle, MSLane* source);
+
     /// @brief return the closer follower of ego
     static MSVehicle* getCloserFollower(const SUMOReal maxPos, MSVehicle* follow1, MSVehicle* follow2);
 
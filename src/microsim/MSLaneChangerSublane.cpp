@@ -191,6 +191,7 @@ MSLaneChangerSublane::startChangeSublane(MSVehicle* vehicle, ChangerIt& from, SU
         const SUMOReal latOffset = vehicle->getLane()->getRightSideOnEdge() - shadowLane->getRightSideOnEdge();
         (myChanger.begin() + shadowLane->getIndex())->ahead.addLeader(vehicle, false, latOffset);
     }
+    registerLateralMove(vehicle, from->lane);
     if (gDebugFlag4) std::cout << SIMTIME << " startChangeSublane shadowLane"
                                    << " old=" << Named::getIDSecure(oldShadowLane)
                                    << " new=" << Named::getIDSecure(vehicle->getLaneChangeModel().getShadowLane()) << "\n";
@@ -50,13 +50,23 @@
 // ===========================================================================
 // MSLeaderInfo member method definitions
 // ===========================================================================
-MSLeaderInfo::MSLeaderInfo(const MSLane* lane, const MSVehicle* ego, SUMOReal latOffset) :
-    myWidth(lane->getWidth()),
-    myVehicles(MAX2(1, int(ceil(myWidth / MSGlobals::gLateralResolution))), (MSVehicle*)0),
-    myFreeSublanes((int)myVehicles.size()),
-    egoRightMost(-1),
-    egoLeftMost(-1),
-    myHasVehicles(false) {
+MSLeaderInfo::MSLeaderInfo(const MSLane* lane, const MSVehicle* ego, SUMOReal latOffset) {
+    reset(lane, ego, latOffset);
+}
+
+
+MSLeaderInfo::~MSLeaderInfo() { }
+
+
+void
+MSLeaderInfo::reset(const MSLane* lane, const MSVehicle* ego, SUMOReal latOffset) {
+    myWidth = lane->getWidth();
+    // assign keeps the capacity, so no memory is allocated once the vector fits the widest lane
+    myVehicles.assign(MAX2(1, int(ceil(myWidth / MSGlobals::gLateralResolution))), (MSVehicle*)0);
+    myFreeSublanes = (int)myVehicles.size();
+    egoRightMost = -1;
+    egoLeftMost = -1;
+    myHasVehicles = false;
     if (ego != 0) {
         getSubLanes(ego, latOffset, egoRightMost, egoLeftMost);
         // filter out sublanes not of interest to ego
@@ -66,9 +76,6 @@ MSLeaderInfo::MSLeaderInfo(const MSLane* lane, const MSVehicle* ego, SUMOReal la
 }
 
 
-MSLeaderInfo::~MSLeaderInfo() { }
-
-
 int
 MSLeaderInfo::addLeader(const MSVehicle* veh, bool beyond, SUMOReal latOffset) {
     if (veh == 0) {
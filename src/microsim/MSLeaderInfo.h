@@ -73,6 +73,13 @@ public:
     /// @brief discard all information
     virtual void clear();
 
+    /** @brief reinitializes this instance for the given lane and ego vehicle
+     *
+     * Equivalent to assigning a newly constructed instance but reuses the
+     *  allocated memory (only valid for instances of MSLeaderInfo itself)
+     */
+    void reset(const MSLane* lane, const MSVehicle* ego = 0, SUMOReal latOffset = 0);
+
     /* @brief adds this vehicle as a leader in the appropriate sublanes
      * @param[in] veh The vehicle to check
      * @param[out] rightmost The rightmost sublane occupied by veh
@@ -69,6 +69,9 @@ const SUMOReal MSLink::ZIPPER_ADAPT_DIST(100);
 MSLink::MSLink(MSLane* predLane, MSLane* succLane, LinkDirection dir, LinkState state, SUMOReal length, SUMOReal foeVisibilityDistance, bool keepClear, MSTrafficLightLogic* logic, int tlIndex) :
     myLane(succLane),
     myLaneBefore(predLane),
+    myApproachingWindowBegin(SUMOTime_MAX),
+    myApproachingWindowEnd(SUMOTime_MIN),
+    myApproachingWindowOutdated(false),
     myIndex(-1),
     myTLIndex(tlIndex),
     myLogic(logic),
@@ -89,6 +92,9 @@ MSLink::MSLink(MSLane* predLane, MSLane* succLane, LinkDirection dir, LinkState
 MSLink::MSLink(MSLane* predLane, MSLane* succLane, MSLane* via, LinkDirection dir, LinkState state, SUMOReal length, SUMOReal foeVisibilityDistance, bool keepClear, MSTrafficLightLogic* logic, int tlIndex) :
     myLane(succLane),
     myLaneBefore(predLane),
+    myApproachingWindowBegin(SUMOTime_MAX),
+    myApproachingWindowEnd(SUMOTime_MIN),
+    myApproachingWindowOutdated(false),
     myIndex(-1),
     myTLIndex(tlIndex),
     myLogic(logic),
@@ -267,9 +273,14 @@ void
 MSLink::setApproaching(const SUMOVehicle* approaching, const SUMOTime arrivalTime, const SUMOReal arrivalSpeed, const SUMOReal leaveSpeed,
                        const bool setRequest, const SUMOTime arrivalTimeBraking, const SUMOReal arrivalSpeedBraking, const SUMOTime waitingTime, SUMOReal dist) {
     const SUMOTime leaveTime = getLeaveTime(arrivalTime, arrivalSpeed, leaveSpeed, approaching->getVehicleType().getLength());
-    myApproachingVehicles.insert(std::make_pair(approaching,
-                                 ApproachingVehicleInformation(arrivalTime, leaveTime, arrivalSpeed, leaveSpeed, setRequest,
-                                         arrivalTimeBraking, arrivalSpeedBraking, waitingTime, dist)));
+    const bool added = myApproachingVehicles.insert(std::make_pair(approaching,
+                       ApproachingVehicleInformation(arrivalTime, leaveTime, arrivalSpeed, leaveSpeed, setRequest,
+                               arrivalTimeBraking, arrivalSpeedBraking, waitingTime, dist))).second;
+    if (added && setRequest && !myApproachingWindowOutdated) {
+        // the earliest arrival is decreased by one to account for rounding the impatient arrival time in blockedByFoe
+        myApproachingWindowBegin = MIN2(myApproachingWindowBegin, MIN2(arrivalTime, arrivalTimeBraking) - 1);
+        myApproachingWindowEnd = MAX2(myApproachingWindowEnd, leaveTime);
+    }
 }
 
 
@@ -293,7 +304,27 @@ MSLink::willHaveBlockedFoe() const {
 
 void
 MSLink::removeApproaching(const SUMOVehicle* veh) {
-    myApproachingVehicles.erase(veh);
+    if (myApproachingVehicles.erase(veh) > 0) {
+        myApproachingWindowOutdated = true;
+    }
+}
+
+
+bool
+MSLink::outsideApproachingWindow(SUMOTime arrivalTime, SUMOTime leaveTime) const {
+    if (myApproachingWindowOutdated) {
+        myApproachingWindowBegin = SUMOTime_MAX;
+        myApproachingWindowEnd = SUMOTime_MIN;
+        for (std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator i = myApproachingVehicles.begin(); i != myApproachingVehicles.end(); ++i) {
+            const ApproachingVehicleInformation& avi = i->second;
+            if (avi.willPass) {
+                myApproachingWindowBegin = MIN2(myApproachingWindowBegin, MIN2(avi.arrivalTime, avi.arrivalTimeBraking) - 1);
+                myApproachingWindowEnd = MAX2(myApproachingWindowEnd, avi.leavingTime);
+            }
+        }
+        myApproachingWindowOutdated = false;
+    }
+    return leaveTime < myApproachingWindowBegin || arrivalTime > myApproachingWindowEnd;
 }
 
 
@@ -331,6 +362,9 @@ MSLink::opened(SUMOTime arrivalTime, SUMOReal arrivalSpeed, SUMOReal leaveSpeed,
         for (std::vector<MSLink*>::const_iterator it = mySublaneFoeLinks.begin(); it != mySublaneFoeLinks.end(); ++it) {
             const MSLink* foeLink = *it;
             assert(myLane != foeLink->getLane());
+            if (foeLink->outsideApproachingWindow(arrivalTime, leaveTime)) {
+                continue;
+            }
             for (std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator i = foeLink->myApproachingVehicles.begin(); i != foeLink->myApproachingVehicles.end(); ++i) {
                 const SUMOVehicle* foe = i->first;
                 if (
@@ -387,6 +421,9 @@ bool
 MSLink::blockedAtTime(SUMOTime arrivalTime, SUMOTime leaveTime, SUMOReal arrivalSpeed, SUMOReal leaveSpeed,
                       bool sameTargetLane, SUMOReal impatience, SUMOReal decel, SUMOTime waitingTime,
                       std::vector<const SUMOVehicle*>* collectFoes) const {
+    if (!sameTargetLane && outsideApproachingWindow(arrivalTime, leaveTime)) {
+        return false;
+    }
     for (std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator i = myApproachingVehicles.begin(); i != myApproachingVehicles.end(); ++i) {
         if (blockedByFoe(i->first, i->second, arrivalTime, leaveTime, arrivalSpeed, leaveSpeed, sameTargetLane,
                          impatience, decel, waitingTime)) {
@@ -621,6 +658,14 @@ MSLink::fromInternalLane() const {
 MSLink::LinkLeaders
 MSLink::getLeaderInfo(SUMOReal dist, SUMOReal minGap, std::vector<const MSPerson*>* collectBlockers) const {
     LinkLeaders result;
+    getLeaderInfo(result, dist, minGap, collectBlockers);
+    return result;
+}
+
+
+void
+MSLink::getLeaderInfo(LinkLeaders& result, SUMOReal dist, SUMOReal minGap, std::vector<const MSPerson*>* collectBlockers) const {
+    result.clear();
     //gDebugFlag1 = true;
     // this link needs to start at an internal lane (either an exit link or between two internal lanes)
     if (fromInternalLane()) {
@@ -691,7 +736,6 @@ MSLink::getLeaderInfo(SUMOReal dist, SUMOReal minGap, std::vector<const MSPerson
             }
         }
     }
-    return result;
 }
 #endif
 
@@ -403,6 +403,15 @@ public:
      * @return The all vehicles on foeLanes and their (virtual) distances to the asking vehicle
      */
     LinkLeaders getLeaderInfo(SUMOReal dist, SUMOReal minGap, std::vector<const MSPerson*>* collectBlockers = 0) const;
+
+    /** @brief Stores all potential link leaders in the given container
+     * As getLeaderInfo above but reuses the memory of the given container
+     * @param[filled] result The container to replace the content of
+     * @param[in] dist The distance of the vehicle who is asking about the leader to this link
+     * @param[in] minGap The minGap of the vehicle who is asking about the leader to this link
+     * @param[out] blocking Return blocking pedestrians if a vector is given
+     */
+    void getLeaderInfo(LinkLeaders& result, SUMOReal dist, SUMOReal minGap, std::vector<const MSPerson*>* collectBlockers = 0) const;
 #endif
 
     /// @brief return the speed at which ego vehicle must approach the zipper link
@@ -478,6 +487,19 @@ private:
     bool blockedByFoe(const SUMOVehicle* veh, const ApproachingVehicleInformation& avi, SUMOTime arrivalTime, SUMOTime leaveTime, SUMOReal arrivalSpeed, SUMOReal leaveSpeed,
                       bool sameTargetLane, SUMOReal impatience, SUMOReal decel, SUMOTime waitingTime) const;
 
+    /** @brief Returns whether no approaching vehicle may block a vehicle passing within the given times
+     *
+     * A vehicle which occupies the link between arrivalTime and leaveTime
+     *  cannot conflict with approaching vehicles arriving later or leaving
+     *  earlier unless they enter the same lane (see blockedByFoe). Allows
+     *  to skip the check of the single vehicles.
+     *
+     * @param[in] arrivalTime The arrival time of the vehicle checking the link
+     * @param[in] leaveTime The time the vehicle checking the link leaves it
+     * @return Whether the vehicles approaching this link do not need to be checked
+     */
+    bool outsideApproachingWindow(SUMOTime arrivalTime, SUMOTime leaveTime) const;
+
 private:
     /// @brief The lane behind the junction approached by this link
     MSLane* myLane;
@@ -486,6 +508,13 @@ private:
     MSLane* myLaneBefore;
 
     std::map<const SUMOVehicle*, ApproachingVehicleInformation> myApproachingVehicles;
+
+    /// @brief The earliest arrival and the latest leaving time of the approaching vehicles which want to pass
+    mutable SUMOTime myApproachingWindowBegin;
+    mutable SUMOTime myApproachingWindowEnd;
+    /// @brief Whether the window has to be recomputed as vehicles were removed
+    mutable bool myApproachingWindowOutdated;
+
     std::set<MSLink*> myBlockedFoeLinks;
 
     /// @brief The position within this respond
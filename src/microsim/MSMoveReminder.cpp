@@ -39,7 +39,8 @@
 // ===========================================================================
 MSMoveReminder::MSMoveReminder(const std::string& description, MSLane* const lane, const bool doAdd) :
     myLane(lane),
-    myDescription(description) {
+    myDescription(description),
+    myNotifyMoveBegin(-std::numeric_limits<SUMOReal>::max()) {
     if (myLane != 0 && doAdd) {
         // add reminder to lane
         myLane->addMoveReminder(this);
@@ -35,6 +35,7 @@
 #endif
 
 #include <map>
+#include <limits>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/StdDefs.h>
 
@@ -91,6 +92,18 @@ public:
     }
 
 
+    /** @brief Returns the position on the lane before which notifyMove has no effect
+     *
+     * While the front of a vehicle is upstream of this position, notifyMove
+     *  would only return true, so the vehicle does not call it.
+     *
+     * @return The first position at which vehicle moves are of interest
+     */
+    SUMOReal getNotifyMoveBegin() const {
+        return myNotifyMoveBegin;
+    }
+
+
     /// @brief Definition of a vehicle state
     enum Notification {
         /// @brief The vehicle has departed (was inserted into the network)
@@ -235,6 +248,8 @@ protected:
     MSLane* const myLane;
     /// @brief a description of this moveReminder
     std::string myDescription;
+    /// @brief the position on myLane before which notifyMove has no effect (to be set by subclasses)
+    SUMOReal myNotifyMoveBegin;
 
 private:
     std::map<SUMOVehicle*, std::pair<SUMOTime, SUMOReal> > myLastVehicleUpdateValues;
@@ -61,6 +61,7 @@
 #include "trigger/MSTrigger.h"
 #include "trigger/MSCalibrator.h"
 #include "traffic_lights/MSTLLogicControl.h"
+#include "MSVehicle.h"
 #include "MSVehicleControl.h"
 #include <utils/common/MsgHandler.h>
 #include <utils/common/ToString.h>
@@ -70,6 +71,7 @@
 #include <microsim/devices/MSDevice_Vehroutes.h>
 #include <microsim/devices/MSDevice_Tripinfo.h>
 #include <microsim/devices/MSDevice_BTsender.h>
+#include <microsim/devices/MSDevice_DUA.h>
 #include "traffic_lights/MSTrafficLightLogic.h"
 #include <utils/shapes/Polygon.h>
 #include <utils/shapes/ShapeContainer.h>
@@ -86,11 +88,13 @@
 #include "output/MSXMLRawOut.h"
 #include "output/MSAmitranTrajectories.h"
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/common/MemoryPool.h>
 #include <utils/common/SysUtils.h>
 #include <utils/common/WrappingCommand.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/vehicle/PedestrianRouter.h>
 #include "MSGlobals.h"
+#include "MSStepProfiler.h"
 #include <microsim/pedestrians/MSPModel.h>
 #include <microsim/MSCModel_NonInteracting.h>
 #include <utils/geom/GeoConvHelper.h>
@@ -100,6 +104,7 @@
 #include "MSStateHandler.h"
 
 #include <mesosim/MELoop.h>
+#include <mesosim/MESegment.h>
 
 #ifndef NO_TRACI
 #include <traci-server/TraCIServer.h>
@@ -183,7 +188,7 @@ MSNet::MSNet(MSVehicleControl* vc, MSEventControl* beginOfTimestepEvents,
     myStep = string2time(oc.getString("begin"));
     myLogExecutionTime = !oc.getBool("no-duration-log");
     myLogStepNumber = !oc.getBool("no-step-log");
-    myInserter = new MSInsertionControl(*vc, string2time(oc.getString("max-depart-delay")), !oc.getBool("eager-insert"), oc.getInt("max-num-vehicles"));
+    myInserter = new MSInsertionControl(*vc, string2time(oc.getString("max-depart-delay")), !oc.getBool("eager-insert"), oc.getBool("lane-insert-once"), oc.getInt("max-num-vehicles"));
     myVehicleControl = vc;
     myDetectorControl = new MSDetectorControl();
     myEdges = 0;
@@ -281,6 +286,7 @@ MSNet::~MSNet() {
     if (MSGlobals::gUseMesoSim) {
         delete MSGlobals::gMesoNet;
     }
+    MemoryPool::clear();
 //    delete myPedestrianRouter;
     myInstance = 0;
 }
@@ -315,7 +321,6 @@ MSNet::simulate(SUMOTime start, SUMOTime stop) {
 #ifdef HAVE_PYTHON
     if (OptionsCont::getOptions().isSet("python-script")) {
         TraCIServer::runEmbedded(OptionsCont::getOptions().getString("python-script"));
-        closeSimulation(start);
         WRITE_MESSAGE("Simulation ended at time: " + time2string(getCurrentTimeStep()));
         WRITE_MESSAGE("Reason: Script ended");
         return 0;
@@ -342,8 +347,6 @@ MSNet::simulate(SUMOTime start, SUMOTime stop) {
     // report the end when wished
     WRITE_MESSAGE("Simulation ended at time: " + time2string(getCurrentTimeStep()));
     WRITE_MESSAGE("Reason: " + getStateMessage(state));
-    // exit simulation loop
-    closeSimulation(start);
     return 0;
 }
 
@@ -366,6 +369,14 @@ MSNet::closeSimulation(SUMOTime start) {
             msg.setf(std::ios::showpoint);    // print decimal point
             msg << " UPS: " << ((SUMOReal)myVehiclesMoved / ((SUMOReal)duration / 1000)) << "\n";
         }
+        const long peakMemory = SysUtils::getPeakMemoryKB();
+        if (peakMemory >= 0) {
+            msg << " Peak memory: " << peakMemory / 1024 << "MB (" << myVehicleControl->getLoadedVehicleNo() << " vehicles loaded)\n";
+        }
+        const std::string cacheStatistics = MSDevice_Routing::getRouteCacheStatistics();
+        if (cacheStatistics != "") {
+            msg << " Route cache: " << cacheStatistics << "\n";
+        }
         // print vehicle statistics
         const std::string discardNotice = ((myVehicleControl->getLoadedVehicleNo() != myVehicleControl->getDepartedVehicleNo()) ?
                                            " (Loaded: " + toString(myVehicleControl->getLoadedVehicleNo()) + ")" : "");
@@ -404,9 +415,28 @@ MSNet::closeSimulation(SUMOTime start) {
         }
         if (OptionsCont::getOptions().getBool("duration-log.statistics")) {
             msg << MSDevice_Tripinfo::printStatistics();
+            const std::string poolStatistics = MemoryPool::getStatistics();
+            if (poolStatistics != "") {
+                msg << "Memory pool: " << poolStatistics << "\n";
+            }
         }
         WRITE_MESSAGE(msg.str());
     }
+    if (MSStepProfiler::isEnabled()) {
+        const std::string profileSummary = MSStepProfiler::writeSummary();
+        if (profileSummary != "") {
+            WRITE_MESSAGE(profileSummary);
+        }
+    }
+    writeFinalOutputs();
+#ifndef NO_TRACI
+    TraCIServer::close();
+#endif
+}
+
+
+void
+MSNet::writeFinalOutputs() {
     myDetectorControl->close(myStep);
     if (OptionsCont::getOptions().getBool("vehroute-output.write-unfinished")) {
         MSDevice_Vehroutes::generateOutputForUnfinished();
@@ -414,18 +444,77 @@ MSNet::closeSimulation(SUMOTime start) {
     if (OptionsCont::getOptions().getBool("tripinfo-output.write-unfinished")) {
         MSDevice_Tripinfo::generateOutputForUnfinished();
     }
-#ifndef NO_TRACI
-    TraCIServer::close();
+}
+
+
+void
+MSNet::clearState(const SUMOTime step) {
+    if (hasPersons() || hasContainers()) {
+        throw ProcessError("The simulation state cannot be reset when persons or containers are simulated.");
+    }
+#ifdef HAVE_FOX
+    MSDevice_Routing::waitForAll();
 #endif
+    // remove the running vehicles without generating output
+    const MSEdgeVector& edges = MSEdge::getAllEdges();
+    if (MSGlobals::gUseMesoSim) {
+        for (MSEdgeVector::const_iterator e = edges.begin(); e != edges.end(); ++e) {
+            for (MESegment* s = MSGlobals::gMesoNet->getSegmentForEdge(**e); s != 0; s = s->getNextSegment()) {
+                s->clearState(myStep);
+            }
+        }
+    } else {
+        for (MSVehicleControl::constVehIt i = myVehicleControl->loadedVehBegin(); i != myVehicleControl->loadedVehEnd(); ++i) {
+            if ((*i).second->hasDeparted()) {
+                MSVehicle* const veh = static_cast<MSVehicle*>((*i).second);
+                veh->onRemovalFromNet(MSMoveReminder::NOTIFICATION_VAPORIZED);
+                if (veh->getLane() != 0) {
+                    veh->getLane()->removeVehicle(veh, MSMoveReminder::NOTIFICATION_VAPORIZED, false);
+                }
+            }
+        }
+    }
+    myInserter->clearState();
+    myVehicleControl->clearState();
+    MSDevice_Routing::clearState();
+    // rewind the time
+    myBeginOfTimestepEvents->clearState(myStep, step);
+    myEndOfTimestepEvents->clearState(myStep, step);
+    myInsertionEvents->clearState(myStep, step);
+    myStep = step;
+    myLogics->clearState(step);
+    myDetectorControl->clearState();
+    for (MSEdgeVector::const_iterator e = edges.begin(); e != edges.end(); ++e) {
+        (*e)->setLastFailedInsertionTime(-1);
+        const std::vector<MSLane*>& lanes = (*e)->getLanes();
+        for (std::vector<MSLane*>::const_iterator l = lanes.begin(); l != lanes.end(); ++l) {
+            (*l)->clearState();
+        }
+    }
+    // restart the performance computation
+    myVehiclesMoved = 0;
+    if (myLogExecutionTime) {
+        mySimBeginMillis = SysUtils::getCurrentMillis();
+    }
 }
 
 
 void
 MSNet::simulationStep() {
+    const bool profile = MSStepProfiler::isEnabled();
+    if (profile) {
+        MSStepProfiler::beginStep();
+    }
 #ifndef NO_TRACI
-    TraCIServer::processCommandsUntilSimStep(myStep);
+    {
+        STEP_PROFILE_PHASE(TRACI);
+        TraCIServer::processCommandsUntilSimStep(myStep);
+    }
     TraCIServer* t = TraCIServer::getInstance();
     if (t != 0 && t->getTargetTime() != 0 && t->getTargetTime() < myStep) {
+        if (profile) {
+            MSStepProfiler::discardStep();
+        }
         return;
     }
 #endif
@@ -433,76 +522,128 @@ MSNet::simulationStep() {
     if (myLogExecutionTime) {
         mySimStepBegin = SysUtils::getCurrentMillis();
     }
+    const int departedBefore = myVehicleControl->getDepartedVehicleNo();
     // simulation state output
     std::vector<SUMOTime>::iterator timeIt = find(myStateDumpTimes.begin(), myStateDumpTimes.end(), myStep);
     if (timeIt != myStateDumpTimes.end()) {
+        STEP_PROFILE_PHASE(SAVE_STATE);
         const int dist = (int)distance(myStateDumpTimes.begin(), timeIt);
         MSStateHandler::saveState(myStateDumpFiles[dist], myStep);
     }
     if (myStateDumpPeriod > 0 && myStep % myStateDumpPeriod == 0) {
+        STEP_PROFILE_PHASE(SAVE_STATE);
         MSStateHandler::saveState(myStateDumpPrefix + "_" + time2string(myStep) + myStateDumpSuffix, myStep);
     }
-    myBeginOfTimestepEvents->execute(myStep);
+    {
+        STEP_PROFILE_PHASE(EVENTS);
+        myBeginOfTimestepEvents->execute(myStep);
+    }
 #ifdef HAVE_FOX
-    MSDevice_Routing::waitForAll();
+    {
+        STEP_PROFILE_PHASE(ROUTING_WAIT);
+        MSDevice_Routing::waitForAll();
+    }
 #endif
     if (MSGlobals::gCheck4Accidents) {
+        STEP_PROFILE_PHASE(COLLISIONS);
         myEdges->detectCollisions(myStep, STAGE_EVENTS);
     }
     // check whether the tls programs need to be switched
-    myLogics->check2Switch(myStep);
+    {
+        STEP_PROFILE_PHASE(TLS);
+        myLogics->check2Switch(myStep);
+    }
 
     if (MSGlobals::gUseMesoSim) {
+        STEP_PROFILE_PHASE(MESO);
         MSGlobals::gMesoNet->simulate(myStep);
     } else {
-        // assure all lanes with vehicles are 'active'
-        myEdges->patchActiveLanes();
-
-        // compute safe velocities for all vehicles for the next few lanes
-        // also register ApproachingVehicleInformation for all links
-        myEdges->planMovements(myStep);
+        {
+            STEP_PROFILE_PHASE(PLAN_MOVEMENTS);
+            // assure all lanes with vehicles are 'active'
+            myEdges->patchActiveLanes();
+
+            // compute safe velocities for all vehicles for the next few lanes
+            // also register ApproachingVehicleInformation for all links
+            myEdges->planMovements(myStep);
+        }
 
         // decide right-of-way and execute movements
-        myEdges->executeMovements(myStep);
+        {
+            STEP_PROFILE_PHASE(EXECUTE_MOVEMENTS);
+            myEdges->executeMovements(myStep);
+        }
         if (MSGlobals::gCheck4Accidents) {
+            STEP_PROFILE_PHASE(COLLISIONS);
             myEdges->detectCollisions(myStep, STAGE_MOVEMENTS);
         }
 
         // vehicles may change lanes
-        myEdges->changeLanes(myStep);
+        {
+            STEP_PROFILE_PHASE(LANE_CHANGE);
+            myEdges->changeLanes(myStep);
+        }
 
         if (MSGlobals::gCheck4Accidents) {
+            STEP_PROFILE_PHASE(COLLISIONS);
             myEdges->detectCollisions(myStep, STAGE_LANECHANGE);
         }
     }
-    loadRoutes();
-
-    // persons
-    if (myPersonControl != 0 && myPersonControl->hasTransportables()) {
-        myPersonControl->checkWaiting(this, myStep);
+    {
+        STEP_PROFILE_PHASE(LOAD_ROUTES);
+        loadRoutes();
     }
-    // containers
-    if (myContainerControl != 0 && myContainerControl->hasTransportables()) {
-        myContainerControl->checkWaiting(this, myStep);
+
+    {
+        STEP_PROFILE_PHASE(PERSONS);
+        // persons
+        if (myPersonControl != 0 && myPersonControl->hasTransportables()) {
+            myPersonControl->checkWaiting(this, myStep);
+        }
+        // containers
+        if (myContainerControl != 0 && myContainerControl->hasTransportables()) {
+            myContainerControl->checkWaiting(this, myStep);
+        }
     }
     // insert vehicles
-    myInserter->determineCandidates(myStep);
-    myInsertionEvents->execute(myStep);
+    {
+        STEP_PROFILE_PHASE(INSERTION);
+        myInserter->determineCandidates(myStep);
+    }
+    {
+        STEP_PROFILE_PHASE(EVENTS);
+        myInsertionEvents->execute(myStep);
+    }
 #ifdef HAVE_FOX
-    MSDevice_Routing::waitForAll();
+    {
+        STEP_PROFILE_PHASE(ROUTING_WAIT);
+        MSDevice_Routing::waitForAll();
+        MSDevice_DUA::waitForAll();
+    }
 #endif
-    myInserter->emitVehicles(myStep);
+    {
+        STEP_PROFILE_PHASE(INSERTION);
+        myInserter->emitVehicles(myStep);
+    }
     if (MSGlobals::gCheck4Accidents) {
+        STEP_PROFILE_PHASE(COLLISIONS);
         //myEdges->patchActiveLanes(); // @note required to detect collisions on lanes that were empty before insertion. wasteful?
         myEdges->detectCollisions(myStep, STAGE_INSERTIONS);
     }
-    MSVehicleTransfer::getInstance()->checkInsertions(myStep);
+    {
+        STEP_PROFILE_PHASE(INSERTION);
+        MSVehicleTransfer::getInstance()->checkInsertions(myStep);
+    }
 
     // execute endOfTimestepEvents
-    myEndOfTimestepEvents->execute(myStep);
+    {
+        STEP_PROFILE_PHASE(EVENTS);
+        myEndOfTimestepEvents->execute(myStep);
+    }
 
 #ifndef NO_TRACI
     if (TraCIServer::getInstance() != 0) {
+        STEP_PROFILE_PHASE(TRACI);
         TraCIServer::getInstance()->postProcessVTD();
     }
 #endif
@@ -514,6 +655,10 @@ MSNet::simulationStep() {
         mySimStepDuration = mySimStepEnd - mySimStepBegin;
         myVehiclesMoved += myVehicleControl->getRunningVehicleNo();
     }
+    if (profile) {
+        MSStepProfiler::endStep(myStep, MSGlobals::gUseMesoSim ? 0 : myEdges->getActiveLaneNumber(),
+                                myVehicleControl->getDepartedVehicleNo() - departedBefore, myVehicleControl->getRunningVehicleNo());
+    }
     myStep += DELTA_T;
 }
 
@@ -577,6 +722,7 @@ MSNet::clearAll() {
     MSEdge::clear();
     MSLane::clear();
     MSRoute::clear();
+    MSVehicle::clearBestLanesCache();
     delete MSVehicleTransfer::getInstance();
     MSDevice_Routing::cleanup();
     MSTrigger::cleanup();
@@ -590,50 +736,60 @@ MSNet::clearAll() {
 void
 MSNet::writeOutput() {
     // update detector values
-    myDetectorControl->updateDetectors(myStep);
+    {
+        STEP_PROFILE_PHASE(DETECTORS);
+        myDetectorControl->updateDetectors(myStep);
+    }
     const OptionsCont& oc = OptionsCont::getOptions();
 
     // check state dumps
     if (oc.isSet("netstate-dump")) {
+        STEP_PROFILE_PHASE(NETSTATE_OUTPUT);
         MSXMLRawOut::write(OutputDevice::getDeviceByOption("netstate-dump"), *myEdges, myStep,
                            oc.getInt("netstate-dump.precision"));
     }
 
     // check fcd dumps
     if (OptionsCont::getOptions().isSet("fcd-output")) {
+        STEP_PROFILE_PHASE(FCD_OUTPUT);
         MSFCDExport::write(OutputDevice::getDeviceByOption("fcd-output"), myStep, myHasElevation);
     }
 
     // check emission dumps
     if (OptionsCont::getOptions().isSet("emission-output")) {
+        STEP_PROFILE_PHASE(EMISSION_OUTPUT);
         MSEmissionExport::write(OutputDevice::getDeviceByOption("emission-output"), myStep,
                                 oc.getInt("emission-output.precision"));
     }
 
     // battery dumps
     if (OptionsCont::getOptions().isSet("battery-output")) {
+        STEP_PROFILE_PHASE(BATTERY_OUTPUT);
         MSBatteryExport::write(OutputDevice::getDeviceByOption("battery-output"), myStep,
                                oc.getInt("battery-output.precision"));
     }
 
     // check full dumps
     if (OptionsCont::getOptions().isSet("full-output")) {
+        STEP_PROFILE_PHASE(FULL_OUTPUT);
         MSFullExport::write(OutputDevice::getDeviceByOption("full-output"), myStep);
     }
 
     // check queue dumps
     if (OptionsCont::getOptions().isSet("queue-output")) {
+        STEP_PROFILE_PHASE(QUEUE_OUTPUT);
         MSQueueExport::write(OutputDevice::getDeviceByOption("queue-output"), myStep);
     }
 
     // check amitran dumps
     if (OptionsCont::getOptions().isSet("amitran-output")) {
+        STEP_PROFILE_PHASE(AMITRAN_OUTPUT);
         MSAmitranTrajectories::write(OutputDevice::getDeviceByOption("amitran-output"), myStep);
     }
 
     // check vtk dumps
     if (OptionsCont::getOptions().isSet("vtk-output")) {
-
+        STEP_PROFILE_PHASE(VTK_OUTPUT);
         if (MSNet::getInstance()->getVehicleControl().getRunningVehicleNo() > 0) {
             std::string timestep = time2string(myStep);
             timestep = timestep.substr(0, timestep.length() - 3);
@@ -651,6 +807,7 @@ MSNet::writeOutput() {
 
     // summary output
     if (OptionsCont::getOptions().isSet("summary-output")) {
+        STEP_PROFILE_PHASE(SUMMARY_OUTPUT);
         OutputDevice& od = OutputDevice::getDeviceByOption("summary-output");
         int departedVehiclesNumber = myVehicleControl->getDepartedVehicleNo();
         const SUMOReal meanWaitingTime = departedVehiclesNumber != 0 ? myVehicleControl->getTotalDepartureDelay() / (SUMOReal) departedVehiclesNumber : -1.;
@@ -667,10 +824,14 @@ MSNet::writeOutput() {
     }
 
     // write detector values
-    myDetectorControl->writeOutput(myStep + DELTA_T, false);
+    {
+        STEP_PROFILE_PHASE(DETECTORS);
+        myDetectorControl->writeOutput(myStep + DELTA_T, false);
+    }
 
     // write link states
     if (OptionsCont::getOptions().isSet("link-output")) {
+        STEP_PROFILE_PHASE(LINK_OUTPUT);
         OutputDevice& od = OutputDevice::getDeviceByOption("link-output");
         od.openTag("timestep");
         od.writeAttr(SUMO_ATTR_ID, STEPS2TIME(myStep));
@@ -715,7 +876,7 @@ MSNet::getContainerControl() {
 MSEdgeWeightsStorage&
 MSNet::getWeightsStorage() {
     if (myEdgeWeights == 0) {
-        myEdgeWeights = new MSEdgeWeightsStorage();
+        myEdgeWeights = new MSEdgeWeightsStorage(true);
     }
     return *myEdgeWeights;
 }
@@ -205,6 +205,11 @@ public:
 
 
     /** @brief Simulates from timestep start to stop
+     *
+     * The simulation is not closed afterwards, so it may be reset using
+     *  clearState and simulated again. closeSimulation has to be called
+     *  after the last run.
+     *
      * @param[in] start The begin time step of the simulation
      * @param[in] stop The end time step of the simulation
      * @return Returns always 0
@@ -226,7 +231,8 @@ public:
 
     /** @brief Closes the simulation (all files, connections, etc.)
      *
-     * Writes also performance output
+     * Writes also performance output (of the run since the last clearState)
+     *  and the final outputs (writeFinalOutputs)
      *
      * @param[in] start The step the simulation was started with
      * @todo What exceptions may occure?
@@ -234,6 +240,32 @@ public:
     void closeSimulation(SUMOTime start);
 
 
+    /** @brief Writes the outputs due at the end of a run
+     *
+     * Flushes the last detector intervals and writes the vehroute and tripinfo
+     *  outputs of the unfinished vehicles if wished.
+     */
+    void writeFinalOutputs();
+
+
+    /** @brief Resets the simulation to the given time, removing all vehicles
+     *
+     * Running vehicles are removed without generating output, all vehicles
+     *  are deleted and the vehicles and flows waiting for insertion are
+     *  forgotten. The traffic light programs, the periodic outputs and the
+     *  detectors are restarted, the edge weights of the rerouting devices
+     *  are forgotten. The network, the vehicle types and the routes are kept,
+     *  so new vehicles may be added and simulated afterwards.
+     *
+     * @param[in] step The time the simulation continues at
+     * @exception ProcessError If persons or containers are simulated or if
+     *  pending events cannot be restarted (e.g. of variable speed signs,
+     *  rerouters, calibrators or traffic light programs other than static,
+     *  actuated or rail ones)
+     */
+    void clearState(const SUMOTime step);
+
+
     /** @brief Called after a simulation step, this method returns the current simulation state
      * @param[in] stopTime The time the simulation shall stop at
      * @return The current simulation state
@@ -52,6 +52,9 @@
 // ===========================================================================
 MSRoute::RouteDict MSRoute::myDict;
 MSRoute::RouteDistDict MSRoute::myDistDict;
+MSRoute::EdgesDict MSRoute::myEdgesDict;
+std::vector<MSRoute::EdgesDict::iterator> MSRoute::myEdgesByID;
+std::vector<int> MSRoute::myFreeEdgesIDs;
 #ifdef HAVE_FOX
 FXMutex MSRoute::myDictMutex(true);
 #endif
@@ -64,38 +67,79 @@ MSRoute::MSRoute(const std::string& id,
                  const ConstMSEdgeVector& edges,
                  const bool isPermanent, const RGBColor* const c,
                  const std::vector<SUMOVehicleParameter::Stop>& stops)
-    : Named(id), myEdges(edges), myAmPermanent(isPermanent),
+    : Named(id), myEdges(0), myEdgesID(-1), myAmPermanent(isPermanent),
       myReferenceCounter(isPermanent ? 1 : 0),
-      myColor(c), myStops(stops) {}
+      myColor(c), myStops(stops) {
+    myEdges = internEdges(edges, myEdgesID);
+}
 
 
 MSRoute::~MSRoute() {
     delete myColor;
+    releaseEdges(myEdgesID);
 }
 
 
 MSRouteIterator
 MSRoute::begin() const {
-    return myEdges.begin();
+    return myEdges->begin();
 }
 
 
 MSRouteIterator
 MSRoute::end() const {
-    return myEdges.end();
+    return myEdges->end();
 }
 
 
 int
 MSRoute::size() const {
-    return (int)myEdges.size();
+    return (int)myEdges->size();
 }
 
 
 const MSEdge*
 MSRoute::getLastEdge() const {
-    assert(myEdges.size() > 0);
-    return myEdges[myEdges.size() - 1];
+    assert(myEdges->size() > 0);
+    return myEdges->back();
+}
+
+
+const ConstMSEdgeVector*
+MSRoute::internEdges(const ConstMSEdgeVector& edges, int& id) {
+#ifdef HAVE_FOX
+    FXMutexLock f(myDictMutex);
+#endif
+    EdgesDict::iterator i = myEdgesDict.find(edges);
+    if (i == myEdgesDict.end()) {
+        int newID = (int)myEdgesByID.size();
+        if (myFreeEdgesIDs.empty()) {
+            myEdgesByID.push_back(myEdgesDict.end());
+        } else {
+            newID = myFreeEdgesIDs.back();
+            myFreeEdgesIDs.pop_back();
+        }
+        i = myEdgesDict.insert(std::make_pair(edges, std::make_pair(0, newID))).first;
+        myEdgesByID[newID] = i;
+    }
+    i->second.first++;
+    id = i->second.second;
+    return &i->first;
+}
+
+
+void
+MSRoute::releaseEdges(const int id) {
+#ifdef HAVE_FOX
+    FXMutexLock f(myDictMutex);
+#endif
+    // the numerical id saves comparing the edges when looking up the sequence
+    const EdgesDict::iterator i = myEdgesByID[id];
+    if (--i->second.first == 0) {
+        myEdgesDict.erase(i);
+        myEdgesByID[id] = myEdgesDict.end();
+        myFreeEdgesIDs.push_back(id);
+    }
 }
 
 
@@ -225,17 +269,17 @@ MSRoute::insertIDs(std::vector<std::string>& into) {
 int
 MSRoute::writeEdgeIDs(OutputDevice& os, const MSEdge* const from, const MSEdge* const upTo) const {
     int numWritten = 0;
-    ConstMSEdgeVector::const_iterator i = myEdges.begin();
+    ConstMSEdgeVector::const_iterator i = myEdges->begin();
     if (from != 0) {
-        i = std::find(myEdges.begin(), myEdges.end(), from);
+        i = std::find(myEdges->begin(), myEdges->end(), from);
     }
-    for (; i != myEdges.end(); ++i) {
+    for (; i != myEdges->end(); ++i) {
         if ((*i) == upTo) {
             return numWritten;
         }
         os << (*i)->getID();
         numWritten++;
-        if (upTo || i != myEdges.end() - 1) {
+        if (upTo || i != myEdges->end() - 1) {
             os << ' ';
         }
     }
@@ -257,7 +301,7 @@ MSRoute::containsAnyOf(const MSEdgeVector& edgelist) const {
 
 const MSEdge*
 MSRoute::operator[](int index) const {
-    return myEdges[index];
+    return (*myEdges)[index];
 }
 
 
@@ -269,7 +313,7 @@ MSRoute::dict_saveState(OutputDevice& out) {
     for (RouteDict::iterator it = myDict.begin(); it != myDict.end(); ++it) {
         out.openTag(SUMO_TAG_ROUTE).writeAttr(SUMO_ATTR_ID, (*it).second->getID());
         out.writeAttr(SUMO_ATTR_STATE, (*it).second->myAmPermanent);
-        out.writeAttr(SUMO_ATTR_EDGES, (*it).second->myEdges).closeTag();
+        out.writeAttr(SUMO_ATTR_EDGES, *(*it).second->myEdges).closeTag();
     }
     for (RouteDistDict::iterator it = myDistDict.begin(); it != myDistDict.end(); ++it) {
         out.openTag(SUMO_TAG_ROUTE_DISTRIBUTION).writeAttr(SUMO_ATTR_ID, (*it).first);
@@ -284,17 +328,17 @@ MSRoute::dict_saveState(OutputDevice& out) {
 SUMOReal
 MSRoute::getDistanceBetween(SUMOReal fromPos, SUMOReal toPos,
                             const MSEdge* fromEdge, const MSEdge* toEdge, bool includeInternal) const {
-    ConstMSEdgeVector::const_iterator it = std::find(myEdges.begin(), myEdges.end(), fromEdge);
-    if (it == myEdges.end() || std::find(it, myEdges.end(), toEdge) == myEdges.end()) {
+    ConstMSEdgeVector::const_iterator it = std::find(myEdges->begin(), myEdges->end(), fromEdge);
+    if (it == myEdges->end() || std::find(it, myEdges->end(), toEdge) == myEdges->end()) {
         // start or destination not contained in route
         return std::numeric_limits<SUMOReal>::max();
     }
-    ConstMSEdgeVector::const_iterator it2 = std::find(it + 1, myEdges.end(), toEdge);
+    ConstMSEdgeVector::const_iterator it2 = std::find(it + 1, myEdges->end(), toEdge);
 
     if (fromEdge == toEdge) {
         if (fromPos <= toPos) {
             return toPos - fromPos;
-        } else if (it2 == myEdges.end()) {
+        } else if (it2 == myEdges->end()) {
             // we don't visit the edge again
             return std::numeric_limits<SUMOReal>::max();
         }
@@ -108,7 +108,7 @@ public:
     int writeEdgeIDs(OutputDevice& os, const MSEdge* const from, const MSEdge* const upTo = 0) const;
 
     bool contains(const MSEdge* const edge) const {
-        return std::find(myEdges.begin(), myEdges.end(), edge) != myEdges.end();
+        return std::find(myEdges->begin(), myEdges->end(), edge) != myEdges->end();
     }
 
     bool containsAnyOf(const MSEdgeVector& edgelist) const;
@@ -126,7 +126,16 @@ public:
     /// @}
 
     const ConstMSEdgeVector& getEdges() const {
-        return myEdges;
+        return *myEdges;
+    }
+
+    /** @brief Returns the numerical id of the route's edge sequence
+     *
+     * Routes have the same numerical edges id if and only if they pass the same
+     *  edges. The id of a sequence no longer used may be given to a new one.
+     */
+    int getEdgesID() const {
+        return myEdgesID;
     }
 
     /** @brief Compute the distance between 2 given edges on this route, including the length of internal lanes.
@@ -230,8 +239,11 @@ public:
     static void insertIDs(std::vector<std::string>& into);
 
 private:
-    /// The list of edges to pass
-    ConstMSEdgeVector myEdges;
+    /// The list of edges to pass (shared by all routes passing the same edges)
+    const ConstMSEdgeVector* myEdges;
+
+    /// The numerical id of the list of edges
+    int myEdgesID;
 
     /// whether the route may be deleted after the last vehicle abandoned it
     const bool myAmPermanent;
@@ -261,11 +273,39 @@ private:
     /// The dictionary container
     static RouteDistDict myDistDict;
 
+    /// @brief Definition of the container of edge sequences, the number of routes using them and their numerical ids
+    typedef std::map<ConstMSEdgeVector, std::pair<int, int> > EdgesDict;
+
+    /// @brief The edge sequences of all existing routes
+    static EdgesDict myEdgesDict;
+
+    /// @brief The edge sequences by numerical id (myEdgesDict.end() for unused ids)
+    static std::vector<EdgesDict::iterator> myEdgesByID;
+
+    /// @brief The numerical ids of edge sequences which are no longer used
+    static std::vector<int> myFreeEdgesIDs;
+
+    /** @brief Returns the stored edge sequence equal to the given one, adding it if needed
+     *
+     * Routes with the same edges (e.g. of many vehicles driving from
+     *  the same origin to the same destination) share one vector.
+     * @param[in] edges The edges to look up
+     * @param[out] id The numerical id of the edge sequence
+     * @return The stored edge sequence
+     */
+    static const ConstMSEdgeVector* internEdges(const ConstMSEdgeVector& edges, int& id);
+
+    /// @brief Removes the edge sequence with the given numerical id if no further route uses it
+    static void releaseEdges(const int id);
+
 #ifdef HAVE_FOX
     /// @brief the mutex for the route dictionaries
     static FXMutex myDictMutex;
 #endif
 private:
+    /** invalid copy constructor */
+    MSRoute(const MSRoute& s);
+
     /** invalid assignment operator */
     MSRoute& operator=(const MSRoute& s);
 
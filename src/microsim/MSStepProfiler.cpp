@@ -0,0 +1,217 @@
+/****************************************************************************/
+/// @file    MSStepProfiler.cpp
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Measures the computation time of the phases of a simulation step
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <sstream>
+#include <utils/common/ToString.h>
+#include <utils/iodevices/OutputDevice.h>
+#include <utils/options/OptionsCont.h>
+#include "MSStepProfiler.h"
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+bool MSStepProfiler::myEnabled(false);
+long long int MSStepProfiler::myStepTimes[PHASE_NUMBER];
+long long int MSStepProfiler::myTotalTimes[PHASE_NUMBER];
+long long int MSStepProfiler::myMaxTimes[PHASE_NUMBER];
+long long int MSStepProfiler::myStepBegin(0);
+int MSStepProfiler::myStepReroutes(0);
+long long int MSStepProfiler::myTotalDuration(0);
+long long int MSStepProfiler::mySteps(0);
+long long int MSStepProfiler::myTotalActiveLanes(0);
+long long int MSStepProfiler::myTotalReroutes(0);
+long long int MSStepProfiler::myTotalInserted(0);
+OutputDevice* MSStepProfiler::myOutput(0);
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+void
+MSStepProfiler::init() {
+#ifndef NO_STEP_PROFILE
+    myEnabled = OptionsCont::getOptions().isSet("step-profile");
+    myOutput = myEnabled ? &OutputDevice::getDeviceByOption("step-profile") : 0;
+#endif
+    for (int i = 0; i < PHASE_NUMBER; i++) {
+        myStepTimes[i] = 0;
+        myTotalTimes[i] = 0;
+        myMaxTimes[i] = 0;
+    }
+    myStepReroutes = 0;
+    myTotalDuration = 0;
+    mySteps = 0;
+    myTotalActiveLanes = 0;
+    myTotalReroutes = 0;
+    myTotalInserted = 0;
+}
+
+
+void
+MSStepProfiler::beginStep() {
+    myStepBegin = SysUtils::getCurrentMicros();
+}
+
+
+void
+MSStepProfiler::discardStep() {
+    for (int i = 0; i < PHASE_NUMBER; i++) {
+        myStepTimes[i] = 0;
+    }
+    myStepReroutes = 0;
+}
+
+
+void
+MSStepProfiler::endStep(SUMOTime step, int activeLanes, int inserted, int running) {
+    const long long int duration = SysUtils::getCurrentMicros() - myStepBegin;
+    myOutput->openTag("step");
+    myOutput->writeAttr("time", time2string(step));
+    myOutput->writeAttr("duration", duration);
+    for (int i = 0; i < PHASE_NUMBER; i++) {
+        myOutput->writeAttr(getName((Phase)i), myStepTimes[i]);
+        myTotalTimes[i] += myStepTimes[i];
+        if (myStepTimes[i] > myMaxTimes[i]) {
+            myMaxTimes[i] = myStepTimes[i];
+        }
+        myStepTimes[i] = 0;
+    }
+    myOutput->writeAttr("activeLanes", activeLanes);
+    myOutput->writeAttr("reroutes", myStepReroutes);
+    myOutput->writeAttr("inserted", inserted);
+    myOutput->writeAttr("running", running);
+    myOutput->closeTag();
+    myTotalDuration += duration;
+    myTotalActiveLanes += activeLanes;
+    myTotalReroutes += myStepReroutes;
+    myTotalInserted += inserted;
+    myStepReroutes = 0;
+    mySteps++;
+}
+
+
+std::string
+MSStepProfiler::writeSummary() {
+    if (mySteps == 0) {
+        return "";
+    }
+    const SUMOReal steps = (SUMOReal)mySteps;
+    myOutput->openTag("summary");
+    myOutput->writeAttr("steps", mySteps);
+    myOutput->writeAttr("duration", myTotalDuration);
+    myOutput->writeAttr("meanActiveLanes", (SUMOReal)myTotalActiveLanes / steps);
+    myOutput->writeAttr("reroutes", myTotalReroutes);
+    myOutput->writeAttr("inserted", myTotalInserted);
+    std::ostringstream msg;
+    msg.setf(std::ios::fixed, std::ios::floatfield);
+    msg.precision(2);
+    msg << "Step profile: " << mySteps << " steps, " << (SUMOReal)myTotalDuration / 1000. << "ms\n";
+    for (int i = 0; i < PHASE_NUMBER; i++) {
+        if (myTotalTimes[i] == 0) {
+            continue;
+        }
+        const SUMOReal share = myTotalDuration > 0 ? 100. * (SUMOReal)myTotalTimes[i] / (SUMOReal)myTotalDuration : 0.;
+        myOutput->openTag("phase");
+        myOutput->writeAttr("id", getName((Phase)i));
+        myOutput->writeAttr("total", myTotalTimes[i]);
+        myOutput->writeAttr("mean", (SUMOReal)myTotalTimes[i] / steps);
+        myOutput->writeAttr("max", myMaxTimes[i]);
+        myOutput->writeAttr("share", share);
+        myOutput->closeTag();
+        msg << " " << getName((Phase)i) << ": " << (SUMOReal)myTotalTimes[i] / 1000. << "ms (" << share << "%), max "
+            << (SUMOReal)myMaxTimes[i] / 1000. << "ms\n";
+    }
+    myOutput->closeTag();
+    return msg.str();
+}
+
+
+const char*
+MSStepProfiler::getName(Phase phase) {
+    switch (phase) {
+        case PHASE_TRACI:
+            return "traci";
+        case PHASE_SAVE_STATE:
+            return "saveState";
+        case PHASE_EVENTS:
+            return "events";
+        case PHASE_ROUTING_WAIT:
+            return "routingWait";
+        case PHASE_TLS:
+            return "tls";
+        case PHASE_MESO:
+            return "meso";
+        case PHASE_PLAN_MOVEMENTS:
+            return "planMovements";
+        case PHASE_EXECUTE_MOVEMENTS:
+            return "executeMovements";
+        case PHASE_LANE_CHANGE:
+            return "laneChange";
+        case PHASE_COLLISIONS:
+            return "collisions";
+        case PHASE_LOAD_ROUTES:
+            return "loadRoutes";
+        case PHASE_PERSONS:
+            return "persons";
+        case PHASE_INSERTION:
+            return "insertion";
+        case PHASE_DETECTORS:
+            return "detectors";
+        case PHASE_NETSTATE_OUTPUT:
+            return "netstateOutput";
+        case PHASE_FCD_OUTPUT:
+            return "fcdOutput";
+        case PHASE_EMISSION_OUTPUT:
+            return "emissionOutput";
+        case PHASE_BATTERY_OUTPUT:
+            return "batteryOutput";
+        case PHASE_FULL_OUTPUT:
+            return "fullOutput";
+        case PHASE_QUEUE_OUTPUT:
+            return "queueOutput";
+        case PHASE_AMITRAN_OUTPUT:
+            return "amitranOutput";
+        case PHASE_VTK_OUTPUT:
+            return "vtkOutput";
+        case PHASE_SUMMARY_OUTPUT:
+            return "summaryOutput";
+        case PHASE_LINK_OUTPUT:
+            return "linkOutput";
+        default:
+            return "unknown";
+    }
+}
+
+
+/****************************************************************************/
@@ -0,0 +1,220 @@
+/****************************************************************************/
+/// @file    MSStepProfiler.h
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Measures the computation time of the phases of a simulation step
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef MSStepProfiler_h
+#define MSStepProfiler_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <utils/common/SUMOTime.h>
+#include <utils/common/SysUtils.h>
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class OutputDevice;
+
+
+// ===========================================================================
+// definitions
+// ===========================================================================
+#ifndef NO_STEP_PROFILE
+/// @brief Measures the remainder of the enclosing block as the given phase (MSStepProfiler::Phase without prefix)
+#define STEP_PROFILE_PHASE(phase) MSStepProfiler::ScopedTimer stepProfileTimer(MSStepProfiler::PHASE_##phase)
+#else
+#define STEP_PROFILE_PHASE(phase)
+#endif
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MSStepProfiler
+ * @brief Measures the computation time of the phases of a simulation step
+ *
+ * If "step-profile" is set, the time spent within each phase of
+ *  MSNet::simulationStep is measured using ScopedTimers (created by the
+ *  STEP_PROFILE_PHASE macro) and written together with some counts describing
+ *  the load of the step into the given file. At the end of the simulation an
+ *  aggregated summary is written to the file and to the console.
+ *
+ * If the profiler is disabled, each timer costs a single check. Building with
+ *  NO_STEP_PROFILE defined removes the timers completely.
+ */
+class MSStepProfiler {
+public:
+    /// @brief The measured phases (the order of the output)
+    enum Phase {
+        PHASE_TRACI,
+        PHASE_SAVE_STATE,
+        PHASE_EVENTS,
+        PHASE_ROUTING_WAIT,
+        PHASE_TLS,
+        PHASE_MESO,
+        PHASE_PLAN_MOVEMENTS,
+        PHASE_EXECUTE_MOVEMENTS,
+        PHASE_LANE_CHANGE,
+        PHASE_COLLISIONS,
+        PHASE_LOAD_ROUTES,
+        PHASE_PERSONS,
+        PHASE_INSERTION,
+        PHASE_DETECTORS,
+        PHASE_NETSTATE_OUTPUT,
+        PHASE_FCD_OUTPUT,
+        PHASE_EMISSION_OUTPUT,
+        PHASE_BATTERY_OUTPUT,
+        PHASE_FULL_OUTPUT,
+        PHASE_QUEUE_OUTPUT,
+        PHASE_AMITRAN_OUTPUT,
+        PHASE_VTK_OUTPUT,
+        PHASE_SUMMARY_OUTPUT,
+        PHASE_LINK_OUTPUT,
+        /// @brief The number of phases (no phase)
+        PHASE_NUMBER
+    };
+
+
+    /**
+     * @class ScopedTimer
+     * @brief Adds the time between its construction and destruction to a phase
+     */
+    class ScopedTimer {
+    public:
+        /// @brief Constructor, starts the measurement if the profiler is enabled
+        ScopedTimer(Phase phase) : myPhase(phase), myBegin(myEnabled ? SysUtils::getCurrentMicros() : 0) {}
+
+        /// @brief Destructor, adds the measured time to the phase
+        ~ScopedTimer() {
+            if (myEnabled) {
+                myStepTimes[myPhase] += SysUtils::getCurrentMicros() - myBegin;
+            }
+        }
+
+    private:
+        /// @brief The measured phase
+        const Phase myPhase;
+
+        /// @brief The time the measurement started in microseconds
+        const long long int myBegin;
+
+    private:
+        /// @brief Invalidated copy constructor
+        ScopedTimer(const ScopedTimer& s);
+
+        /// @brief Invalidated assignment operator
+        ScopedTimer& operator=(const ScopedTimer& s);
+    };
+
+
+    /** @brief Enables the profiler if "step-profile" is set and resets all measurements
+     *
+     * The output device has to be built before.
+     */
+    static void init();
+
+
+    /// @brief Returns whether the phases are measured
+    static bool isEnabled() {
+        return myEnabled;
+    }
+
+
+    /// @brief Counts a rerouting within the current step
+    static void addReroute() {
+        myStepReroutes++;
+    }
+
+
+    /// @brief Starts the measurement of a step
+    static void beginStep();
+
+
+    /// @brief Forgets the measurements of a step which is not executed
+    static void discardStep();
+
+
+    /** @brief Writes the measurements of the step and adds them to the totals
+     *
+     * @param[in] step The time of the step
+     * @param[in] activeLanes The number of lanes with vehicles
+     * @param[in] inserted The number of vehicles inserted within the step
+     * @param[in] running The number of running vehicles
+     */
+    static void endStep(SUMOTime step, int activeLanes, int inserted, int running);
+
+
+    /** @brief Writes the aggregated measurements into the output
+     * @return A description of the aggregated measurements for the console
+     */
+    static std::string writeSummary();
+
+
+    /// @brief Returns the name of the phase as used in the output
+    static const char* getName(Phase phase);
+
+
+private:
+    /// @brief Whether the phases are measured
+    static bool myEnabled;
+
+    /// @brief The times of the phases within the current step in microseconds
+    static long long int myStepTimes[PHASE_NUMBER];
+
+    /// @brief The times of the phases summed over all steps in microseconds
+    static long long int myTotalTimes[PHASE_NUMBER];
+
+    /// @brief The maximum times of the phases within a step in microseconds
+    static long long int myMaxTimes[PHASE_NUMBER];
+
+    /// @brief The time the current step started in microseconds
+    static long long int myStepBegin;
+
+    /// @brief The number of reroutings within the current step
+    static int myStepReroutes;
+
+    /// @brief The summed durations of the steps in microseconds
+    static long long int myTotalDuration;
+
+    /// @brief The number of measured steps
+    static long long int mySteps;
+
+    /// @brief The summed counts over all steps
+    static long long int myTotalActiveLanes;
+    static long long int myTotalReroutes;
+    static long long int myTotalInserted;
+
+    /// @brief The output device (0 if disabled)
+    static OutputDevice* myOutput;
+
+};
+
+
+#endif
+
+/****************************************************************************/
@@ -99,9 +99,16 @@
 // @todo Calibrate with real-world values / make configurable
 #define DIST_TO_STOPLINE_EXPECT_PRIORITY 1.0
 
+// the maximum number of best lanes tables kept for sharing
+#define BEST_LANES_CACHE_SIZE 10000
+
 // ===========================================================================
 // static value definitions
 // ===========================================================================
+std::map<MSVehicle::BestLanesKey, std::vector<std::vector<MSVehicle::LaneQ> > > MSVehicle::myBestLanesCache;
+#ifdef HAVE_FOX
+FXMutex MSVehicle::myBestLanesCacheMutex;
+#endif
 std::vector<MSLane*> MSVehicle::myEmptyLaneVector;
 std::vector<MSTransportable*> MSVehicle::myEmptyTransportableVector;
 
@@ -717,6 +724,11 @@ MSVehicle::workOnMoveReminders(SUMOReal oldPos, SUMOReal newPos, SUMOReal newSpe
     // This erasure-idiom works for all stl-sequence-containers
     // See Meyers: Effective STL, Item 9
     for (MoveReminderCont::iterator rem = myMoveReminders.begin(); rem != myMoveReminders.end();) {
+        if (newPos + rem->second < rem->first->getNotifyMoveBegin()) {
+            // the reminder's position is not reached yet, spare the call
+            ++rem;
+            continue;
+        }
         // XXX: calling notifyMove with newSpeed seems not the best choice. For the ballistic update, the average speed is calculated and used
         //      although a higher order quadrature-formula might be more adequate.
         //      For the euler case (where the speed is considered constant for each time step) it is conceivable that
@@ -1274,7 +1286,7 @@ MSVehicle::planMove(const SUMOTime t, const MSLeaderInfo& ahead, const SUMOReal
 
 
 void
-MSVehicle::planMoveInternal(const SUMOTime t, MSLeaderInfo ahead, DriveItemVector& lfLinks, SUMOReal& myStopDist) const {
+MSVehicle::planMoveInternal(const SUMOTime t, const MSLeaderInfo& ahead, DriveItemVector& lfLinks, SUMOReal& myStopDist) const {
 #ifdef DEBUG_VEHICLE_GUI_SELECTION
     if (gDebugSelectedVehicle == getID()) {
         int bla = 0;
@@ -1324,10 +1336,14 @@ MSVehicle::planMoveInternal(const SUMOTime t, MSLeaderInfo ahead, DriveItemVecto
     // iterator over subsequent lanes and fill lfLinks until stopping distance or stopped
     const MSLane* lane = opposite ? myLane->getOpposite() : myLane;
     const MSLane* leaderLane = myLane;
+    // the leaders on leaderLane (0 if they shall be ignored), referenced to avoid copying them
+    const MSLeaderInfo* leaders = &ahead;
     while (true) {
         // check leader on lane
         //  leader is given for the first edge only
-        adaptToLeaders(ahead, 0, seen, lastLink, leaderLane, v, vLinkPass);
+        if (leaders != 0) {
+            adaptToLeaders(*leaders, 0, seen, lastLink, leaderLane, v, vLinkPass);
+        }
 #ifdef DEBUG_PLAN_MOVE
         if (DEBUG_COND) {
             std::cout << "\nv = " << v << "\n";
@@ -1456,8 +1472,8 @@ MSVehicle::planMoveInternal(const SUMOTime t, MSLeaderInfo ahead, DriveItemVecto
 #ifdef HAVE_INTERNAL_LANES
         if (MSGlobals::gUsingInternalLanes) {
             // we want to pass the link but need to check for foes on internal lanes
-            const MSLink::LinkLeaders linkLeaders = (*link)->getLeaderInfo(seen, getVehicleType().getMinGap());
-            for (MSLink::LinkLeaders::const_iterator it = linkLeaders.begin(); it != linkLeaders.end(); ++it) {
+            (*link)->getLeaderInfo(myLinkLeaders, seen, getVehicleType().getMinGap());
+            for (MSLink::LinkLeaders::const_iterator it = myLinkLeaders.begin(); it != myLinkLeaders.end(); ++it) {
                 // the vehicle to enter the junction first has priority
                 const MSVehicle* leader = (*it).vehAndGap.first;
                 if (leader == 0) {
@@ -1560,7 +1576,7 @@ MSVehicle::planMoveInternal(const SUMOTime t, MSLeaderInfo ahead, DriveItemVecto
         // do not restrict results to the current vehicle to allow caching for the current time step
         leaderLane = lane; // (opposite && lane->getOpposite() != 0) ? lane->getOpposite() : lane;
         // ignore leaders while overtaking through the opposite direction lane
-        ahead = opposite ? MSLeaderInfo(leaderLane) : leaderLane->getLastVehicleInformation(0, 0);
+        leaders = opposite ? 0 : &leaderLane->getLastVehicleInformation(0, 0);
         seen += lane->getLength();
         vLinkPass = MIN2(cfModel.estimateSpeedAfterDistance(lane->getLength(), v, cfModel.getMaxAccel()), laneMaxV); // upper bound
         lastLink = &lfLinks.back();
@@ -2466,7 +2482,7 @@ MSVehicle::checkRewindLinkLanes(const SUMOReal lengthsInFront, DriveItemVector&
     for (DriveItemVector::iterator i = lfLinks.begin(); i != lfLinks.end(); ++i) {
         if ((*i).myLink != 0) {
             if ((*i).myLink->getState() == LINKSTATE_ALLWAY_STOP) {
-                (*i).myArrivalTime += (SUMOTime)RandHelper::rand((int)2); // tie braker
+                (*i).myArrivalTime += (SUMOTime)(randStream() * 2); // tie braker
             }
             (*i).myLink->setApproaching(this, (*i).myArrivalTime, (*i).myArrivalSpeed, (*i).getLeaveSpeed(),
                                         (*i).mySetRequest, (*i).myArrivalTimeBraking, (*i).myArrivalSpeedBraking, getWaitingTime(), (*i).myDistance);
@@ -2823,11 +2839,63 @@ MSVehicle::updateBestLanes(bool forceRebuild, const MSLane* startLane) {
         nextStopPos = MAX2(POSITION_EPS, MIN2((SUMOReal)nextStopPos, (SUMOReal)(nextStopEdge->getLength() - 2 * POSITION_EPS)));
     }
 
-    // go forward along the next lanes;
+    // collect the edges to look ahead
+    ConstMSEdgeVector ahead;
+    bool stopAhead = false;
     int seen = 0;
     SUMOReal seenLength = 0;
     bool progress = true;
     for (MSRouteIterator ce = myCurrEdge; progress;) {
+        ahead.push_back(*ce);
+        if (nextStopEdge == *ce) {
+            stopAhead = true;
+            break;
+        }
+        ++seen;
+        seenLength += (*ce)->getLanes()[0]->getLength();
+        ++ce;
+        progress &= (seen <= 4 || seenLength < 3000);
+        progress &= seen <= 8;
+        progress &= ce != myRoute->end();
+    }
+    // without a stop ahead the table is shared with all vehicles of the same class looking ahead the same way
+    BestLanesKey key;
+    if (!stopAhead) {
+        key.vClass = myType->getVehicleClass();
+        key.edges = ahead;
+        const MSRouteIterator following = myCurrEdge + ahead.size();
+        key.edges.push_back(following == myRoute->end() ? 0 : *following);
+        for (int e = 0; e + 1 < (int)ahead.size(); ++e) {
+            const std::vector<MSLane*>& lanes = ahead[e]->getLanes();
+            for (std::vector<MSLane*>::const_iterator i = lanes.begin(); i != lanes.end(); ++i) {
+                const MSLinkCont& links = (*i)->getLinkCont();
+                for (MSLinkCont::const_iterator l = links.begin(); l != links.end(); ++l) {
+                    if (&(*l)->getLane()->getEdge() == ahead[e + 1]) {
+                        key.priorities.push_back((*l)->havePriority());
+                    }
+                }
+            }
+        }
+        bool found = false;
+        {
+#ifdef HAVE_FOX
+            FXMutexLock f(myBestLanesCacheMutex);
+#endif
+            std::map<BestLanesKey, std::vector<std::vector<LaneQ> > >::const_iterator cached = myBestLanesCache.find(key);
+            if (cached != myBestLanesCache.end()) {
+                myBestLanes = cached->second;
+                found = true;
+            }
+        }
+        if (found) {
+            updateOccupancyAndCurrentBestLane(startLane);
+            return;
+        }
+    }
+
+    // go forward along the next lanes;
+    MSRouteIterator ce = myCurrEdge;
+    for (int n = 0; n < (int)ahead.size(); ++n, ++ce) {
         std::vector<LaneQ> currentLanes;
         const std::vector<MSLane*>* allowed = 0;
         const MSEdge* nextEdge = 0;
@@ -2851,7 +2919,6 @@ MSVehicle::updateBestLanes(bool forceRebuild, const MSLane* startLane) {
         }
         //
         if (nextStopEdge == *ce) {
-            progress = false;
             for (std::vector<LaneQ>::iterator q = currentLanes.begin(); q != currentLanes.end(); ++q) {
                 if (nextStopLane != 0 && nextStopLane != (*q).lane) {
                     (*q).allowsContinuation = false;
@@ -2860,19 +2927,7 @@ MSVehicle::updateBestLanes(bool forceRebuild, const MSLane* startLane) {
                 }
             }
         }
-
         myBestLanes.push_back(currentLanes);
-        ++seen;
-        seenLength += currentLanes[0].lane->getLength();
-        ++ce;
-        progress &= (seen <= 4 || seenLength < 3000);
-        progress &= seen <= 8;
-        progress &= ce != myRoute->end();
-        /*
-        if(progress) {
-          progress &= (currentLanes.size()!=1||(*ce)->getLanes().size()!=1);
-        }
-        */
     }
 
     // we are examining the last lane explicitly
@@ -3001,6 +3056,15 @@ MSVehicle::updateBestLanes(bool forceRebuild, const MSLane* startLane) {
             }
         }
     }
+    if (!stopAhead) {
+#ifdef HAVE_FOX
+        FXMutexLock f(myBestLanesCacheMutex);
+#endif
+        if (myBestLanesCache.size() >= BEST_LANES_CACHE_SIZE) {
+            myBestLanesCache.clear();
+        }
+        myBestLanesCache[key] = myBestLanes;
+    }
     updateOccupancyAndCurrentBestLane(startLane);
 #ifdef DEBUG_BESTLANES
     if (DEBUG_COND) {
@@ -3011,6 +3075,15 @@ MSVehicle::updateBestLanes(bool forceRebuild, const MSLane* startLane) {
 }
 
 
+void
+MSVehicle::clearBestLanesCache() {
+#ifdef HAVE_FOX
+    FXMutexLock f(myBestLanesCacheMutex);
+#endif
+    myBestLanesCache.clear();
+}
+
+
 int
 MSVehicle::nextLinkPriority(const std::vector<MSLane*>& conts) {
     if (conts.size() < 2) {
@@ -3768,6 +3841,7 @@ MSVehicle::loadState(const SUMOSAXAttributes& attrs, const SUMOTime offset) {
     myState.myPos = attrs.getFloat(SUMO_ATTR_POSITION);
     myState.mySpeed = attrs.getFloat(SUMO_ATTR_SPEED);
     myState.myPosLat = attrs.getFloat(SUMO_ATTR_POSITION_LAT);
+    loadRandomDraws(attrs);
     // no need to reset myCachedPosition here since state loading happens directly after creation
 }
 
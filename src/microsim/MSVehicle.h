@@ -49,6 +49,10 @@
 #include "MSBaseVehicle.h"
 #include "MSLink.h"
 #include "MSLane.h"
+#ifdef HAVE_FOX
+#include <fx.h>
+#include <FXThread.h>
+#endif
 
 #define INVALID_SPEED 299792458 + 1 // nothing can go faster than the speed of light! Refs. #2577
 
@@ -702,6 +706,10 @@ public:
      * A rebuild must be done if the vehicle leaves a stop; then, another lane may become
      *  the best one.
      *
+     * Rebuilt tables are shared: if no stop lies within the look-ahead, a table computed
+     *  before for the same vehicle class, edges and link priorities is copied and only
+     *  the occupancies are updated.
+     *
      * If no starting lane ("startLane") is given, the vehicle's current lane ("myLane")
      *  is used as start of bect lanes building.
      *
@@ -711,6 +719,13 @@ public:
     void updateBestLanes(bool forceRebuild = false, const MSLane* startLane = 0);
 
 
+    /** @brief Removes all best lanes tables shared by the vehicles
+     *
+     * Has to be called if lane permissions change or the network is deleted.
+     */
+    static void clearBestLanesCache();
+
+
     // TODO: improve documentation, refs. #2604
     /** @brief Returns the subpart of best lanes that describes the vehicle's current lane and their successors
      * @return The best lane information for the vehicle's current lane
@@ -1446,6 +1461,37 @@ protected:
 
     std::vector<std::vector<LaneQ> > myBestLanes; // XXX: Documentation?, refs. #2604
     std::vector<LaneQ>::iterator myCurrentLaneInBestLanes;
+
+    /** @struct BestLanesKey
+     * @brief The inputs a best lanes table depends on besides the network's topology
+     */
+    struct BestLanesKey {
+        /// @brief The vehicle class
+        SUMOVehicleClass vClass;
+        /// @brief The edges looked ahead followed by the next route edge (0 at the route's end)
+        ConstMSEdgeVector edges;
+        /// @brief The priorities of the links between the edges looked ahead (changing with traffic light states)
+        std::vector<bool> priorities;
+
+        bool operator<(const BestLanesKey& other) const {
+            if (vClass != other.vClass) {
+                return vClass < other.vClass;
+            }
+            if (edges != other.edges) {
+                return edges < other.edges;
+            }
+            return priorities < other.priorities;
+        }
+    };
+
+    /// @brief The best lanes tables (without occupancies) already computed for the same look-ahead
+    static std::map<BestLanesKey, std::vector<std::vector<LaneQ> > > myBestLanesCache;
+
+#ifdef HAVE_FOX
+    /// @brief The mutex for the best lanes cache (routes are also replaced by the rerouting threads)
+    static FXMutex myBestLanesCacheMutex;
+#endif
+
     static std::vector<MSLane*> myEmptyLaneVector;
     static std::vector<MSTransportable*> myEmptyTransportableVector;
 
@@ -1487,6 +1533,9 @@ protected:
 
     mutable Position myCachedPosition;
 
+    /// @brief the link leaders found within planMoveInternal (kept to reuse its memory)
+    mutable MSLink::LinkLeaders myLinkLeaders;
+
 protected:
     struct DriveProcessItem {
         MSLink* myLink;
@@ -1545,7 +1594,7 @@ protected:
     DriveItemVector myLFLinkLanes;
 
     /// @todo: documentation
-    void planMoveInternal(const SUMOTime t, MSLeaderInfo ahead, DriveItemVector& lfLinks, SUMOReal& myStopDist) const;
+    void planMoveInternal(const SUMOTime t, const MSLeaderInfo& ahead, DriveItemVector& lfLinks, SUMOReal& myStopDist) const;
 
     /// @todo: documentation
     void checkRewindLinkLanes(const SUMOReal lengthsInFront, DriveItemVector& lfLinks) const;
@@ -186,6 +186,29 @@ MSVehicleControl::saveState(OutputDevice& out) {
 }
 
 
+void
+MSVehicleControl::clearState() {
+    for (VehicleDictType::iterator i = myVehicleDict.begin(); i != myVehicleDict.end(); ++i) {
+        delete(*i).second;
+    }
+    myVehicleDict.clear();
+    myWaiting.clear();
+    myWaitingForPerson = 0;
+    myWaitingForContainer = 0;
+    myLoadedVehNo = 0;
+    myRunningVehNo = 0;
+    myEndedVehNo = 0;
+    myDiscarded = 0;
+    myCollisions = 0;
+    myTeleportsJam = 0;
+    myTeleportsYield = 0;
+    myTeleportsWrongLane = 0;
+    myEmergencyStops = 0;
+    myTotalDepartureDelay = 0;
+    myTotalTravelTime = 0;
+}
+
+
 bool
 MSVehicleControl::addVehicle(const std::string& id, SUMOVehicle* v) {
     VehicleDictType::iterator it = myVehicleDict.find(id);
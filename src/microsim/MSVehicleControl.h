@@ -422,6 +422,13 @@ public:
     /** @brief Saves the current state into the given stream
      */
     void saveState(OutputDevice& out);
+
+    /** @brief Deletes all vehicles and resets the statistics
+     *
+     * The vehicles have to be removed from the network and from the insertion
+     *  control before.
+     */
+    void clearState();
     /// @}
 
     /// @brief avoid counting a vehicle twice if it was loaded from state and route input
@@ -66,5 +66,11 @@ Command_SaveTLSState::execute(SUMOTime currentTime) {
 }
 
 
+SUMOTime
+Command_SaveTLSState::shiftTime(SUMOTime /* currentTime */, SUMOTime /* execTime */, SUMOTime newTime) {
+    return newTime;
+}
+
+
 
 /****************************************************************************/
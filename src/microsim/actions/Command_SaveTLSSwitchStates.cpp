@@ -71,6 +71,11 @@ Command_SaveTLSSwitchStates::execute(SUMOTime currentTime) {
 }
 
 
+SUMOTime
+Command_SaveTLSSwitchStates::shiftTime(SUMOTime /* currentTime */, SUMOTime /* execTime */, SUMOTime newTime) {
+    return newTime;
+}
+
 
 /****************************************************************************/
 
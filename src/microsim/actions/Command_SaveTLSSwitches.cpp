@@ -96,6 +96,12 @@ Command_SaveTLSSwitches::execute(SUMOTime currentTime) {
 }
 
 
+SUMOTime
+Command_SaveTLSSwitches::shiftTime(SUMOTime /* currentTime */, SUMOTime /* execTime */, SUMOTime newTime) {
+    myPreviousLinkStates.clear();
+    return newTime;
+}
+
 
 /****************************************************************************/
 
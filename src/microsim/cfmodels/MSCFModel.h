@@ -35,6 +35,7 @@
 #include <math.h>
 #include <string>
 #include <utils/common/StdDefs.h>
+#include <utils/common/MemoryPool.h>
 #include <utils/common/FileHelpers.h>
 
 #define INVALID_SPEED 299792458 + 1 // nothing can go faster than the speed of light!
@@ -64,6 +65,18 @@ public:
     class VehicleVariables {
     public:
         virtual ~VehicleVariables();
+
+#ifndef CHECK_MEMORY_LEAKS
+        /// @brief The variables are allocated from the MemoryPool
+        static void* operator new(size_t size) {
+            return MemoryPool::allocate(size);
+        }
+
+        /// @brief The variables return their memory to the MemoryPool
+        static void operator delete(void* p, size_t size) {
+            MemoryPool::deallocate(p, size);
+        }
+#endif
     };
 
     /** @brief Constructor
@@ -66,7 +66,7 @@ MSCFModel_Daniel1::moveHelper(MSVehicle* const veh, SUMOReal vPos) const {
         WRITE_WARNING("Maximum speed of vehicle '" + veh->getID() + "' is lower than the minimum speed (min: " + toString(vMin) + ", max: " + toString(vMax) + ").");
     }
 #endif
-    return veh->getLaneChangeModel().patchSpeed(vMin, MAX2(vMin, dawdle(vMax)), vMax, *this);
+    return veh->getLaneChangeModel().patchSpeed(vMin, MAX2(vMin, dawdle(vMax, veh)), vMax, *this);
 }
 
 
@@ -83,8 +83,8 @@ MSCFModel_Daniel1::stopSpeed(const MSVehicle* const veh, const SUMOReal speed, S
 
 
 SUMOReal
-MSCFModel_Daniel1::dawdle(SUMOReal speed) const {
-    return MAX2(SUMOReal(0), speed - ACCEL2SPEED(myDawdle * myAccel * RandHelper::rand()));
+MSCFModel_Daniel1::dawdle(SUMOReal speed, const MSVehicle* const veh) const {
+    return MAX2(SUMOReal(0), speed - ACCEL2SPEED(myDawdle * myAccel * veh->randStream()));
 }
 
 
@@ -33,7 +33,6 @@
 #include <microsim/MSVehicle.h>
 #include <microsim/MSLane.h>
 #include "MSCFModel_Kerner.h"
-#include <utils/common/RandHelper.h>
 
 
 // ===========================================================================
@@ -53,7 +52,7 @@ SUMOReal
 MSCFModel_Kerner::moveHelper(MSVehicle* const veh, SUMOReal vPos) const {
     const SUMOReal vNext = MSCFModel::moveHelper(veh, vPos);
     VehicleVariables* vars = (VehicleVariables*)veh->getCarFollowVariables();
-    vars->rand = RandHelper::rand();
+    vars->rand = veh->randStream();
     return vNext;
 }
 
@@ -73,7 +72,8 @@ MSCFModel_Kerner::stopSpeed(const MSVehicle* const veh, const SUMOReal speed, SU
 MSCFModel::VehicleVariables*
 MSCFModel_Kerner::createVehicleVariables() const {
     VehicleVariables* ret = new VehicleVariables();
-    ret->rand = RandHelper::rand();
+    // drawn from the vehicle's stream when first used
+    ret->rand = -1;
     return ret;
 }
 
@@ -88,6 +88,9 @@ MSCFModel_Kerner::_v(const MSVehicle* const veh, SUMOReal speed, SUMOReal vfree,
     SUMOReal vcond = gap > G ? speed + ACCEL2SPEED(myAccel) : speed + MAX2(ACCEL2SPEED(-myDecel), MIN2(ACCEL2SPEED(myAccel), predSpeed - speed));
     SUMOReal vsafe = (SUMOReal)(-1. * myTauDecel + sqrt(myTauDecel * myTauDecel + (predSpeed * predSpeed) + (2. * myDecel * gap)));
     VehicleVariables* vars = (VehicleVariables*)veh->getCarFollowVariables();
+    if (vars->rand < 0) {
+        vars->rand = veh->randStream();
+    }
     SUMOReal va = MAX2((SUMOReal) 0, MIN3(vfree, vsafe, vcond)) + vars->rand;
     SUMOReal v = MAX2((SUMOReal) 0, MIN4(vfree, va, speed + ACCEL2SPEED(myAccel), vsafe));
     return v;
@@ -77,7 +77,7 @@ MSCFModel_Krauss::followSpeed(const MSVehicle* const veh, SUMOReal speed, SUMORe
 
 
 SUMOReal
-MSCFModel_Krauss::dawdle(SUMOReal speed) const {
+MSCFModel_Krauss::dawdle(SUMOReal speed, const MSVehicle* const veh) const {
     if (!MSGlobals::gSemiImplicitEulerUpdate) {
         // in case of the ballistic update, negative speeds indicate
         // a desired stop before the completion of the next timestep.
@@ -87,7 +87,7 @@ MSCFModel_Krauss::dawdle(SUMOReal speed) const {
         }
     }
     // generate random number out of [0,1)
-    const SUMOReal random = RandHelper::rand();
+    const SUMOReal random = veh->randStream();
     // Dawdle.
     if (speed < myAccel) {
         // we should not prevent vehicles from driving just due to dawdling
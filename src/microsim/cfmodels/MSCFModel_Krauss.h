@@ -103,9 +103,10 @@ private:
 
     /** @brief Applies driver imperfection (dawdling / sigma)
      * @param[in] speed The speed with no dawdling
+     * @param[in] veh The vehicle whose random stream is used
      * @return The speed after dawdling
      */
-    SUMOReal dawdle(SUMOReal speed) const;
+    SUMOReal dawdle(SUMOReal speed, const MSVehicle* const veh) const;
 
 };
 
@@ -71,7 +71,7 @@ MSCFModel_KraussOrig1::moveHelper(MSVehicle* const veh, SUMOReal vPos) const {
     //}
 #endif
 
-    const SUMOReal vDawdle = MAX2(vMin, dawdle(vMax));
+    const SUMOReal vDawdle = MAX2(vMin, dawdle(vMax, veh));
 
     SUMOReal vNext = veh->getLaneChangeModel().patchSpeed(vMin, vDawdle, vMax, *this);
 
@@ -130,7 +130,7 @@ MSCFModel_KraussOrig1::stopSpeed(const MSVehicle* const veh, const SUMOReal spee
 
 
 SUMOReal
-MSCFModel_KraussOrig1::dawdle(SUMOReal speed) const {
+MSCFModel_KraussOrig1::dawdle(SUMOReal speed, const MSVehicle* const veh) const {
     if (!MSGlobals::gSemiImplicitEulerUpdate) {
         // in case of the ballistic update, negative speeds indicate
         // a desired stop before the completion of the next timestep.
@@ -139,7 +139,7 @@ MSCFModel_KraussOrig1::dawdle(SUMOReal speed) const {
             return speed;
         }
     }
-    return MAX2(SUMOReal(0), speed - ACCEL2SPEED(myDawdle * myAccel * RandHelper::rand()));
+    return MAX2(SUMOReal(0), speed - ACCEL2SPEED(myDawdle * myAccel * veh->randStream()));
 }
 
 
@@ -171,9 +171,10 @@ private:
 
     /** @brief Applies driver imperfection (dawdling / sigma)
      * @param[in] speed The speed with no dawdling
+     * @param[in] veh The vehicle whose random stream is used
      * @return The speed after dawdling
      */
-    virtual SUMOReal dawdle(SUMOReal speed) const;
+    virtual SUMOReal dawdle(SUMOReal speed, const MSVehicle* const veh) const;
 
 protected:
     /// @brief The vehicle's dawdle-parameter. 0 for no dawdling, 1 for max.
@@ -74,11 +74,11 @@ MSCFModel_PWag2009::followSpeed(const MSVehicle* const veh, SUMOReal speed, SUMO
     const SUMOReal asafe = SPEED2ACCEL(vsafe - speed);
     VehicleVariables* vars = (VehicleVariables*)veh->getCarFollowVariables();
     SUMOReal apref = vars->aOld;
-    if (apref <= asafe && RandHelper::rand() <= myActionPointProbability * TS) {
+    if (apref <= asafe && veh->randStream() <= myActionPointProbability * TS) {
         apref = myDecelDivTau * (gap + (predSpeed - speed) * myHeadwayTime - speed * myHeadwayTime) / (speed + myTauDecel);
         apref = MIN2(apref, myAccel);
         apref = MAX2(apref, -myDecel);
-        apref += myDawdle * RandHelper::rand((SUMOReal) - 1., (SUMOReal)1.);
+        apref += myDawdle * (2 * veh->randStream() - 1);
     }
     if (apref > asafe) {
         apref = asafe;
@@ -122,7 +122,7 @@ MSCFModel_PWag2009::dawdle(SUMOReal speed) const {
 //  const SUMOReal asafe = SPEED2ACCEL(vsafe - speed);
 //    VehicleVariables* vars = (VehicleVariables*)veh->getCarFollowVariables();
 //  SUMOReal apref = vars->aOld;
-//  if (apref <= asafe && RandHelper::rand() <= myActionPointProbability * TS) {
+//  if (apref <= asafe && veh->randStream() <= myActionPointProbability * TS) {
 //    apref = myDecelDivTau * (gap + (predSpeed - speed) * myHeadwayTime - speed * myHeadwayTime) / (speed + myTauDecel);
 //    if (apref>myAccel)
 //      apref = myAccel;
@@ -104,7 +104,7 @@ MSCFModel_SmartSK::moveHelper(MSVehicle* const veh, SUMOReal vPos) const {
 
     vars->gOld = vars->ggOld[(int) vPos];
     vars->ggOld.clear();
-    return veh->getLaneChangeModel().patchSpeed(vMin, MAX2(vMin, dawdle(vMax)), vMax, *this);
+    return veh->getLaneChangeModel().patchSpeed(vMin, MAX2(vMin, dawdle(vMax, veh)), vMax, *this);
 }
 
 SUMOReal
@@ -150,8 +150,8 @@ MSCFModel_SmartSK::stopSpeed(const MSVehicle* const veh, const SUMOReal speed, S
 
 
 SUMOReal
-MSCFModel_SmartSK::dawdle(SUMOReal speed) const {
-    return MAX2(SUMOReal(0), speed - ACCEL2SPEED(myDawdle * myAccel * RandHelper::rand()));
+MSCFModel_SmartSK::dawdle(SUMOReal speed, const MSVehicle* const veh) const {
+    return MAX2(SUMOReal(0), speed - ACCEL2SPEED(myDawdle * myAccel * veh->randStream()));
 }
 
 
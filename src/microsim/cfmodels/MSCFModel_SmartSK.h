@@ -155,15 +155,16 @@ private:
 
     /** @brief Applies driver imperfection (dawdling / sigma)
      * @param[in] speed The speed with no dawdling
+     * @param[in] veh The vehicle whose random stream is used
      * @return The speed after dawdling
      */
-    virtual SUMOReal dawdle(SUMOReal speed) const;
+    virtual SUMOReal dawdle(SUMOReal speed, const MSVehicle* const veh) const;
 
     virtual void updateMyHeadway(const MSVehicle* const veh) const {
         // this is the point were the preferred headway changes slowly:
         SSKVehicleVariables* vars = (SSKVehicleVariables*)veh->getCarFollowVariables();
         SUMOReal tTau = vars->myHeadway;
-        tTau = tTau + (myHeadwayTime - tTau) * myTmp2 + myTmp3 * tTau * RandHelper::rand(SUMOReal(-1.0), SUMOReal(1.0));
+        tTau = tTau + (myHeadwayTime - tTau) * myTmp2 + myTmp3 * tTau * (2 * veh->randStream() - 1);
         if (tTau < TS) { // this ensures the SK safety condition
             tTau = TS;
         }
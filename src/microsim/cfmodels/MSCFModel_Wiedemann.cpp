@@ -38,7 +38,6 @@
 #include "MSCFModel_Wiedemann.h"
 #include <microsim/MSVehicle.h>
 #include <microsim/MSLane.h>
-#include <utils/common/RandHelper.h>
 
 
 // ===========================================================================
@@ -120,7 +119,7 @@ MSCFModel_Wiedemann::_v(const MSVehicle* veh, SUMOReal predSpeed, SUMOReal gap)
     const SUMOReal sdv_root = (dx - myAX) / myCX;
     const SUMOReal sdv = sdv_root * sdv_root;
     const SUMOReal cldv = sdv * ex * ex;
-    const SUMOReal opdv = cldv * (-1 - 2 * RandHelper::randNorm(0.5, 0.15));
+    const SUMOReal opdv = cldv * (-1 - 2 * veh->randNormStream(0.5, 0.15));
     // select the regime, get new acceleration, compute new speed based
     SUMOReal accel;
     if (dx <= bx) {
@@ -35,6 +35,7 @@
 #include "MSDevice_Vehroutes.h"
 #include "MSDevice_Tripinfo.h"
 #include "MSDevice_Routing.h"
+#include "MSDevice_DUA.h"
 #include "MSDevice_Emissions.h"
 #include "MSDevice_BTreceiver.h"
 #include "MSDevice_BTsender.h"
@@ -61,6 +62,7 @@ std::map<std::string, std::set<std::string> > MSDevice::myExplicitIDs;
 void
 MSDevice::insertOptions(OptionsCont& oc) {
     MSDevice_Routing::insertOptions(oc);
+    MSDevice_DUA::insertOptions(oc);
     MSDevice_Emissions::insertOptions();
     MSDevice_BTreceiver::insertOptions(oc);
     MSDevice_BTsender::insertOptions(oc);
@@ -73,6 +75,7 @@ bool
 MSDevice::checkOptions(OptionsCont& oc) {
     bool ok = true;
     ok &= MSDevice_Routing::checkOptions(oc);
+    ok &= MSDevice_DUA::checkOptions(oc);
     return ok;
 }
 
@@ -81,6 +84,7 @@ void
 MSDevice::buildVehicleDevices(SUMOVehicle& v, std::vector<MSDevice*>& into) {
     MSDevice_Vehroutes::buildVehicleDevices(v, into);
     MSDevice_Tripinfo::buildVehicleDevices(v, into);
+    MSDevice_DUA::buildVehicleDevices(v, into);
     MSDevice_Routing::buildVehicleDevices(v, into);
     MSDevice_Emissions::buildVehicleDevices(v, into);
     MSDevice_BTreceiver::buildVehicleDevices(v, into);
@@ -37,6 +37,7 @@
 #include <map>
 #include <set>
 #include <microsim/MSMoveReminder.h>
+#include <utils/common/MemoryPool.h>
 #include <utils/common/Named.h>
 #include <utils/common/UtilExceptions.h>
 
@@ -102,6 +103,18 @@ public:
     /// @brief Destructor
     virtual ~MSDevice() { }
 
+#ifndef CHECK_MEMORY_LEAKS
+    /// @brief Devices are allocated from the MemoryPool
+    static void* operator new(size_t size) {
+        return MemoryPool::allocate(size);
+    }
+
+    /// @brief Devices return their memory to the MemoryPool
+    static void operator delete(void* p, size_t size) {
+        MemoryPool::deallocate(p, size);
+    }
+#endif
+
 
     /** @brief Returns the vehicle that holds this device
      *
@@ -0,0 +1,531 @@
+/****************************************************************************/
+/// @file    MSDevice_DUA.cpp
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A device which chooses the vehicle's route during in-process assignment iterations
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <algorithm>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <typeinfo>
+#include <utils/common/MsgHandler.h>
+#include <utils/common/RandHelper.h>
+#include <utils/common/ToString.h>
+#include <utils/options/OptionsCont.h>
+#include <utils/iodevices/OutputDevice.h>
+#include <utils/vehicle/SUMOVehicle.h>
+#include <utils/vehicle/SUMOVehicleParameter.h>
+#include <utils/vehicle/DijkstraRouterTT.h>
+#include <utils/vehicle/AStarRouter.h>
+#include <microsim/MSNet.h>
+#include <microsim/MSEdge.h>
+#include <microsim/MSRoute.h>
+#include <microsim/MSEventControl.h>
+#include <microsim/MSInsertionControl.h>
+#include <microsim/MSVehicleControl.h>
+#include <microsim/MSVehicleType.h>
+#include "MSDevice_Routing.h"
+#include "MSDevice_DUA.h"
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// static member variables
+// ===========================================================================
+int MSDevice_DUA::myIteration = 0;
+SUMOTime MSDevice_DUA::myAggregation = -1;
+std::vector<std::vector<std::pair<SUMOReal, int> > > MSDevice_DUA::myMeasurements;
+std::vector<std::vector<SUMOReal> > MSDevice_DUA::myTravelTimes;
+std::vector<MSDevice_DUA::AssignedVehicle> MSDevice_DUA::myVehicles;
+SUMOAbstractRouter<MSEdge, SUMOVehicle>* MSDevice_DUA::myRouter = 0;
+#ifdef HAVE_FOX
+FXWorkerThread::Pool MSDevice_DUA::myThreadPool;
+std::vector<MSDevice_DUA*> MSDevice_DUA::myPendingChoices;
+FXMutex MSDevice_DUA::myCalculatorMutex;
+#endif
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+// ---------------------------------------------------------------------------
+// static initialisation methods
+// ---------------------------------------------------------------------------
+void
+MSDevice_DUA::insertOptions(OptionsCont& oc) {
+    oc.doRegister("dua.iterations", new Option_Integer(1));
+    oc.addDescription("dua.iterations", "Routing", "Run INT iterations of a dynamic user assignment, choosing the routes anew before each but the first");
+
+    oc.doRegister("dua.aggregation", new Option_String("900", "TIME"));
+    oc.addDescription("dua.aggregation", "Routing", "Aggregate the edge travel times measured for the assignment in intervals of TIME");
+
+    oc.doRegister("route-choice-method", new Option_String("gawron"));
+    oc.addDescription("route-choice-method", "Routing", "Choose a route choice method for the assignment: gawron or logit");
+
+    oc.doRegister("gawron.beta", new Option_Float(SUMOReal(0.3)));
+    oc.addDescription("gawron.beta", "Routing", "Use FLOAT as Gawron's beta");
+
+    oc.doRegister("gawron.a", new Option_Float(SUMOReal(0.05)));
+    oc.addDescription("gawron.a", "Routing", "Use FLOAT as Gawron's a");
+
+    oc.doRegister("logit.beta", new Option_Float(SUMOReal(-1)));
+    oc.addDescription("logit.beta", "Routing", "Use FLOAT as logit's beta");
+
+    oc.doRegister("logit.gamma", new Option_Float(SUMOReal(1)));
+    oc.addDescription("logit.gamma", "Routing", "Use FLOAT as logit's gamma");
+
+    oc.doRegister("logit.theta", new Option_Float(SUMOReal(-1)));
+    oc.addDescription("logit.theta", "Routing", "Use FLOAT as logit's theta (negative values mean auto-estimation)");
+
+    oc.doRegister("max-alternatives", new Option_Integer(5));
+    oc.addDescription("max-alternatives", "Routing", "Prune the number of route alternatives of the assignment to INT");
+
+    oc.doRegister("keep-all-routes", new Option_Bool(false));
+    oc.addDescription("keep-all-routes", "Routing", "Keep route alternatives with near zero probability");
+
+    oc.doRegister("skip-new-routes", new Option_Bool(false));
+    oc.addDescription("skip-new-routes", "Routing", "Only choose among the loaded routes, do not calculate new ones");
+
+    myIteration = 0;
+    myAggregation = -1;
+}
+
+
+bool
+MSDevice_DUA::checkOptions(OptionsCont& oc) {
+    bool ok = true;
+    if (oc.getInt("dua.iterations") < 1) {
+        WRITE_ERROR("The number of assignment iterations must be positive.");
+        ok = false;
+    }
+    if (oc.getInt("dua.iterations") > 1 && oc.exists("remote-port") && oc.getInt("remote-port") != 0) {
+        WRITE_ERROR("An assignment cannot be run when controlled via TraCI.");
+        ok = false;
+    }
+    if (string2time(oc.getString("dua.aggregation")) <= 0) {
+        WRITE_ERROR("The aggregation interval of the assignment must be positive.");
+        ok = false;
+    }
+    if (oc.getString("route-choice-method") != "gawron" && oc.getString("route-choice-method") != "logit") {
+        WRITE_ERROR("Invalid route choice method '" + oc.getString("route-choice-method") + "'.");
+        ok = false;
+    }
+    if (oc.getInt("max-alternatives") < 2) {
+        WRITE_ERROR("At least two alternatives should be enabled.");
+        ok = false;
+    }
+    if (oc.getInt("dua.iterations") > 1 && oc.getString("routing-algorithm") != "dijkstra" && oc.getString("routing-algorithm") != "astar") {
+        WRITE_WARNING("The assignment cannot use routing algorithm '" + oc.getString("routing-algorithm") + "'. using 'astar' instead.");
+    }
+    return ok;
+}
+
+
+void
+MSDevice_DUA::buildVehicleDevices(SUMOVehicle& v, std::vector<MSDevice*>& into) {
+    OptionsCont& oc = OptionsCont::getOptions();
+    if (oc.getInt("dua.iterations") < 2) {
+        return;
+    }
+    if (myAggregation < 0) {
+        myAggregation = string2time(oc.getString("dua.aggregation"));
+    }
+    into.push_back(new MSDevice_DUA(v, "dua_" + v.getID()));
+}
+
+
+void
+MSDevice_DUA::nextIteration(MSNet& net, SUMOTime begin) {
+#ifdef HAVE_FOX
+    waitForAll();
+#endif
+    finishIteration();
+    // finish the outputs of the last iteration and continue them in new files
+    net.writeFinalOutputs();
+    std::ostringstream suffix;
+    suffix << "_" << std::setw(3) << std::setfill('0') << myIteration;
+    OutputDevice::continueInNewFiles(suffix.str());
+    net.clearState(begin);
+    // rebuild the vehicles remembered within the first iteration
+    MSVehicleControl& vc = net.getVehicleControl();
+    std::set<SUMOVehicleClass> vClasses;
+    for (int i = 0; i < (int)myVehicles.size(); ++i) {
+        const AssignedVehicle& record = myVehicles[i];
+        SUMOVehicleParameter* const pars = new SUMOVehicleParameter(*record.pars);
+        SUMOVehicle* const veh = vc.buildVehicle(pars, record.route, record.type, true, false);
+        veh->setChosenSpeedFactor(record.speedFactor);
+        if (!vc.addVehicle(pars->id, veh)) {
+            vc.deleteVehicle(veh, true);
+            throw ProcessError("Another vehicle with the id '" + record.pars->id + "' exists.");
+        }
+        net.getInsertionControl().add(veh);
+        static_cast<MSDevice_DUA*>(veh->getDevice(typeid(MSDevice_DUA)))->myIndex = i;
+        vClasses.insert(record.type->getVehicleClass());
+    }
+    // fill the lazily built caches before the route choice may run in parallel
+    Calculator::getCalculator();
+    net.getWeightsStorage();
+    const MSEdgeVector& edges = MSEdge::getAllEdges();
+    for (MSEdgeVector::const_iterator e = edges.begin(); e != edges.end(); ++e) {
+        for (std::set<SUMOVehicleClass>::const_iterator c = vClasses.begin(); c != vClasses.end(); ++c) {
+            (*e)->getSuccessors(*c);
+        }
+    }
+}
+
+
+void
+MSDevice_DUA::finishIteration() {
+    myTravelTimes.clear();
+    for (std::vector<std::vector<std::pair<SUMOReal, int> > >::const_iterator i = myMeasurements.begin(); i != myMeasurements.end(); ++i) {
+        myTravelTimes.push_back(std::vector<SUMOReal>());
+        for (std::vector<std::pair<SUMOReal, int> >::const_iterator j = i->begin(); j != i->end(); ++j) {
+            myTravelTimes.back().push_back(j->second > 0 ? j->first / j->second : -1);
+        }
+    }
+    myMeasurements.clear();
+    myIteration++;
+}
+
+
+void
+MSDevice_DUA::cleanup() {
+#ifdef HAVE_FOX
+    if (myThreadPool.size() > 0) {
+        // router deletion is done in thread destructor
+        myThreadPool.clear();
+    }
+    myPendingChoices.clear();
+#endif
+    delete myRouter;
+    myRouter = 0;
+    for (std::vector<AssignedVehicle>::iterator i = myVehicles.begin(); i != myVehicles.end(); ++i) {
+        delete i->pars;
+        i->route->release();
+    }
+    myVehicles.clear();
+    myMeasurements.clear();
+    myTravelTimes.clear();
+    myIteration = 0;
+    myAggregation = -1;
+    Calculator::cleanup();
+}
+
+
+#ifdef HAVE_FOX
+void
+MSDevice_DUA::waitForAll() {
+    if (myThreadPool.size() > 0) {
+        myThreadPool.waitAll();
+    }
+    for (std::vector<MSDevice_DUA*>::const_iterator i = myPendingChoices.begin(); i != myPendingChoices.end(); ++i) {
+        (*i)->applyChoice();
+    }
+    myPendingChoices.clear();
+}
+#endif
+
+
+SUMOAbstractRouter<MSEdge, SUMOVehicle>*
+MSDevice_DUA::buildRouter() {
+    if (OptionsCont::getOptions().getString("routing-algorithm") == "dijkstra") {
+        return new DijkstraRouterTT<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
+                   MSEdge::getAllEdges(), true, &MSDevice_DUA::getTravelTime);
+    }
+    return new AStarRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
+               MSEdge::getAllEdges(), true, &MSDevice_DUA::getTravelTime);
+}
+
+
+// ---------------------------------------------------------------------------
+// route choice and travel time aggregation
+// ---------------------------------------------------------------------------
+bool
+MSDevice_DUA::addAlternative(std::vector<RouteAlternative>& routes, const ConstMSEdgeVector& edges) {
+    if (edges.empty()) {
+        return false;
+    }
+    for (std::vector<RouteAlternative>::const_iterator i = routes.begin(); i != routes.end(); ++i) {
+        if (i->hasEdges(edges)) {
+            return false;
+        }
+    }
+    routes.push_back(RouteAlternative(edges));
+    return true;
+}
+
+
+void
+MSDevice_DUA::updateAlternatives(std::vector<RouteAlternative>& routes, const std::vector<SUMOReal>& costs,
+                                 const bool newRoute, const int lastUsed, Calculator& calculator,
+                                 const SUMOVehicle* const veh, const SUMOTime time) {
+    // recompute the costs and (when a new route was added) scale the probabilities
+    std::vector<RouteAlternative*> alternatives;
+    const SUMOReal scale = SUMOReal(routes.size() - 1) / SUMOReal(routes.size());
+    for (int i = 0; i < (int)routes.size(); ++i) {
+        RouteAlternative* const alt = &routes[i];
+        if (newRoute) {
+            if (i == (int)routes.size() - 1) {
+                // set initial probability and costs
+                alt->setProbability((SUMOReal)(1.0 / (SUMOReal)routes.size()));
+                alt->setCosts(costs[i]);
+            } else {
+                // rescale probs for all others
+                alt->setProbability(alt->getProbability() * scale);
+            }
+        }
+        calculator.setCosts(alt, costs[i], i == lastUsed);
+        alternatives.push_back(alt);
+    }
+    calculator.calculateProbabilities(alternatives, veh, time);
+    if (!calculator.keepRoutes()) {
+        // remove with probability of 0 (not mentioned in Gawron)
+        for (std::vector<RouteAlternative>::iterator i = routes.begin(); i != routes.end() && routes.size() > 1;) {
+            if (i->getProbability() == 0) {
+                i = routes.erase(i);
+            } else {
+                ++i;
+            }
+        }
+    }
+    if ((int)routes.size() > calculator.getMaxRouteNumber()) {
+        // only keep the routes with highest probability
+        std::stable_sort(routes.begin(), routes.end(), probability_comparator());
+        routes.erase(routes.begin() + calculator.getMaxRouteNumber(), routes.end());
+        // rescale probabilities
+        SUMOReal newSum = 0;
+        for (std::vector<RouteAlternative>::const_iterator i = routes.begin(); i != routes.end(); ++i) {
+            newSum += i->getProbability();
+        }
+        for (std::vector<RouteAlternative>::iterator i = routes.begin(); i != routes.end(); ++i) {
+            i->setProbability(i->getProbability() / newSum);
+        }
+    }
+}
+
+
+int
+MSDevice_DUA::chooseAlternative(const std::vector<RouteAlternative>& routes, SUMOReal random) {
+    int pos = 0;
+    for (; pos < (int)routes.size() - 1; ++pos) {
+        random -= routes[pos].getProbability();
+        if (random <= 0) {
+            break;
+        }
+    }
+    return pos;
+}
+
+
+void
+MSDevice_DUA::addMeasurement(const int edgeID, const int interval, const SUMOReal travelTime) {
+    if (edgeID >= (int)myMeasurements.size()) {
+        myMeasurements.resize(edgeID + 1);
+    }
+    if (interval >= (int)myMeasurements[edgeID].size()) {
+        myMeasurements[edgeID].resize(interval + 1, std::make_pair((SUMOReal)0, 0));
+    }
+    myMeasurements[edgeID][interval].first += travelTime;
+    myMeasurements[edgeID][interval].second++;
+}
+
+
+SUMOReal
+MSDevice_DUA::getMeasuredTravelTime(const int edgeID, const int interval) {
+    if (edgeID < 0 || edgeID >= (int)myTravelTimes.size() || interval < 0 || interval >= (int)myTravelTimes[edgeID].size()) {
+        return -1;
+    }
+    return myTravelTimes[edgeID][interval];
+}
+
+
+SUMOReal
+MSDevice_DUA::getTravelTime(const MSEdge* const e, const SUMOVehicle* const v, SUMOReal t) {
+    const SUMOReal measured = getMeasuredTravelTime(e->getNumericalID(), (int)(TIME2STEPS(t) / myAggregation));
+    if (measured >= 0) {
+        return measured;
+    }
+    return MSNet::getTravelTime(e, v, t);
+}
+
+
+// ---------------------------------------------------------------------------
+// MSDevice_DUA-methods
+// ---------------------------------------------------------------------------
+MSDevice_DUA::MSDevice_DUA(SUMOVehicle& holder, const std::string& id) :
+    MSDevice(holder, id), myChoiceCommand(0), myIndex(-1), myEntryEdge(0), myEntryTime(-1) {
+    myChoiceCommand = new WrappingCommand<MSDevice_DUA>(this, &MSDevice_DUA::chooseRoute);
+    MSNet::getInstance()->getInsertionEvents()->addEvent(
+        myChoiceCommand, holder.getParameter().depart,
+        MSEventControl::ADAPT_AFTER_EXECUTION);
+}
+
+
+MSDevice_DUA::~MSDevice_DUA() {
+    // make the choice command invalid if it was not executed
+    if (myChoiceCommand != 0 && MSNet::getInstance()->getInsertionEvents() != 0) {
+        myChoiceCommand->deschedule();
+    }
+}
+
+
+bool
+MSDevice_DUA::notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification reason) {
+    if (reason == MSMoveReminder::NOTIFICATION_JUNCTION && !veh.getEdge()->isInternal()) {
+        myEntryEdge = veh.getEdge();
+        myEntryTime = MSNet::getInstance()->getCurrentTimeStep();
+    }
+    return true;
+}
+
+
+bool
+MSDevice_DUA::notifyLeave(SUMOVehicle& /*veh*/, SUMOReal /*lastPos*/, MSMoveReminder::Notification reason) {
+    if (reason == MSMoveReminder::NOTIFICATION_SEGMENT || reason == MSMoveReminder::NOTIFICATION_LANE_CHANGE) {
+        // still on the same edge
+        return true;
+    }
+    if (reason == MSMoveReminder::NOTIFICATION_JUNCTION && myEntryEdge != 0) {
+        addMeasurement(myEntryEdge->getNumericalID(), (int)(myEntryTime / myAggregation),
+                       STEPS2TIME(MSNet::getInstance()->getCurrentTimeStep() - myEntryTime));
+    }
+    myEntryEdge = 0;
+    return true;
+}
+
+
+SUMOTime
+MSDevice_DUA::chooseRoute(SUMOTime currentTime) {
+    myChoiceCommand = 0;
+    const MSRoute& route = myHolder.getRoute();
+    if (myIndex < 0) {
+        // remember the vehicle as it is going to depart for being rebuilt in the next iterations
+#ifdef HAVE_FOX
+        // the running choices refer to the remembered vehicles
+        waitForAll();
+#endif
+        myIndex = (int)myVehicles.size();
+        AssignedVehicle record;
+        record.pars = new SUMOVehicleParameter(myHolder.getParameter());
+        record.route = &route;
+        route.addReference();
+        record.type = &myHolder.getVehicleType();
+        record.speedFactor = myHolder.getChosenSpeedFactor();
+        record.routes.push_back(RouteAlternative(route.getEdges()));
+        record.lastUsed = 0;
+        myVehicles.push_back(record);
+        // no travel times are known for the choice yet
+        return 0;
+    }
+    if (!route.getStops().empty() || !myHolder.getParameter().stops.empty()) {
+        // routes with stops are not changed
+        return 0;
+    }
+#ifdef HAVE_FOX
+    const int numThreads = OptionsCont::getOptions().getInt("device.rerouting.threads");
+    while (myThreadPool.size() < numThreads) {
+        new WorkerThread(myThreadPool, buildRouter());
+    }
+    if (myThreadPool.size() > 0 && myHolder.getDevice(typeid(MSDevice_Routing)) == 0) {
+        // the rerouting device may change the route within its own threads
+        myPendingChoices.push_back(this);
+        myThreadPool.add(new RouteChoiceTask(*this, currentTime));
+        return 0;
+    }
+    MSDevice_Routing::waitForAll();
+#endif
+    if (myRouter == 0) {
+        myRouter = buildRouter();
+    }
+    choose(*myRouter, currentTime);
+    applyChoice();
+    return 0;
+}
+
+
+void
+MSDevice_DUA::choose(SUMOAbstractRouter<MSEdge, SUMOVehicle>& router, const SUMOTime currentTime) {
+    const MSRoute& route = myHolder.getRoute();
+    AssignedVehicle& record = myVehicles[myIndex];
+    std::vector<RouteAlternative>& routes = record.routes;
+    Calculator& calculator = Calculator::getCalculator();
+    // build a new route to test whether it is better
+    bool newRoute = false;
+    if (!calculator.skipRouteCalculation()) {
+        ConstMSEdgeVector edges;
+        router.compute(route.getEdges().front(), route.getLastEdge(), &myHolder, currentTime, edges);
+        newRoute = addAlternative(routes, edges);
+    }
+    std::vector<SUMOReal> costs;
+    for (std::vector<RouteAlternative>::const_iterator i = routes.begin(); i != routes.end(); ++i) {
+        costs.push_back(router.recomputeCosts(i->getEdgeVector(), &myHolder, currentTime));
+        if (costs.back() < 0.) {
+            // an alternative became invalid, keep the current route
+            if (newRoute) {
+                routes.pop_back();
+            }
+            return;
+        }
+    }
+    {
+#ifdef HAVE_FOX
+        FXMutexLock locker(myCalculatorMutex);
+#endif
+        updateAlternatives(routes, costs, newRoute, record.lastUsed, calculator, &myHolder, currentTime);
+    }
+    // find the route to use
+    const int pos = chooseAlternative(routes, RandHelper::randCounterBased(RandHelper::getStreamID(myHolder.getID()), myIteration));
+    record.lastUsed = pos;
+    if (!routes[pos].hasEdges(route.getEdges())) {
+        myChosenEdges = routes[pos].getEdgeVector();
+    }
+}
+
+
+void
+MSDevice_DUA::applyChoice() {
+    if (!myChosenEdges.empty()) {
+        myHolder.replaceRouteEdges(myChosenEdges, true);
+        myChosenEdges.clear();
+    }
+}
+
+
+#ifdef HAVE_FOX
+// ---------------------------------------------------------------------------
+// MSDevice_DUA::RouteChoiceTask-methods
+// ---------------------------------------------------------------------------
+void
+MSDevice_DUA::RouteChoiceTask::run(FXWorkerThread* context) {
+    myDevice.choose(static_cast<WorkerThread*>(context)->getRouter(), myTime);
+}
+#endif
+
+
+/****************************************************************************/
@@ -0,0 +1,475 @@
+/****************************************************************************/
+/// @file    MSDevice_DUA.h
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A device which chooses the vehicle's route during in-process assignment iterations
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef MSDevice_DUA_h
+#define MSDevice_DUA_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <utils/common/SUMOTime.h>
+#include <utils/common/WrappingCommand.h>
+#include <utils/vehicle/SUMOAbstractRouter.h>
+#include <utils/vehicle/RouteCostCalculator.h>
+#include <microsim/MSEdge.h>
+#include "MSDevice.h"
+
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class MSNet;
+class MSRoute;
+class MSVehicleType;
+class SUMOVehicle;
+class SUMOVehicleParameter;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MSDevice_DUA
+ * @brief A device performing the route choice of a dynamic user assignment
+ *
+ * If more than one iteration is set using "dua.iterations", sumo runs the
+ *  simulation repeatedly and each vehicle gets this device. Within an
+ *  iteration, the device measures the travel times of the edges its vehicle
+ *  passes completely. At the end of the iteration, these are averaged per
+ *  edge and aggregation interval and used as travel times by the routers of
+ *  the next one.
+ *
+ * Within the first iteration, the device remembers the definition of each
+ *  vehicle at its departure time. Between two iterations (nextIteration),
+ *  the network is reset to the begin time and the remembered vehicles are
+ *  built anew, so neither the network nor the demand has to be read again.
+ *  Each iteration writes its outputs into own files.
+ *
+ * Before the vehicle departs, the device recomputes the costs of the vehicle's
+ *  route alternatives, adds the currently fastest route, computes the route
+ *  probabilities using the calculator chosen by "route-choice-method" and lets
+ *  the vehicle drive the chosen alternative, as duarouter does between two
+ *  simulation runs. If "device.rerouting.threads" is set, the routes are
+ *  computed by an own pool of threads whose routers use the measured travel
+ *  times; the chosen routes are given to the vehicles by waitForAll.
+ *
+ * @see MSDevice
+ */
+class MSDevice_DUA : public MSDevice {
+public:
+    /**
+     * @class RouteAlternative
+     * @brief A route alternative of a vehicle with its costs and probability
+     */
+    class RouteAlternative {
+    public:
+        /// @brief Constructor
+        RouteAlternative(const ConstMSEdgeVector& edges) :
+            myEdges(edges), myCosts(-1), myProbability(1) {}
+
+        /// @brief Returns whether this alternative consists of the given edges
+        bool hasEdges(const ConstMSEdgeVector& edges) const {
+            return myEdges == edges;
+        }
+
+        const ConstMSEdgeVector& getEdgeVector() const {
+            return myEdges;
+        }
+
+        SUMOReal getCosts() const {
+            return myCosts;
+        }
+
+        void setCosts(const SUMOReal costs) {
+            myCosts = costs;
+        }
+
+        SUMOReal getProbability() const {
+            return myProbability;
+        }
+
+        void setProbability(const SUMOReal prob) {
+            myProbability = prob;
+        }
+
+    private:
+        /// @brief The route's edges
+        ConstMSEdgeVector myEdges;
+
+        /// @brief The route's costs
+        SUMOReal myCosts;
+
+        /// @brief The probability to choose this route
+        SUMOReal myProbability;
+    };
+
+    /// @brief The calculator computing the costs and probabilities of route alternatives
+    typedef RouteCostCalculator<RouteAlternative, MSEdge, SUMOVehicle> Calculator;
+
+
+    /** @brief Inserts MSDevice_DUA-options
+     * @param[filled] oc The options container to add the options to
+     */
+    static void insertOptions(OptionsCont& oc);
+
+
+    /** @brief checks MSDevice_DUA-options
+     * @param[filled] oc The options container with the user-defined options
+     */
+    static bool checkOptions(OptionsCont& oc);
+
+
+    /** @brief Build devices for the given vehicle, if needed
+     *
+     * All vehicles are equipped if more than one iteration shall be run.
+     *
+     * @param[in] v The vehicle for which a device may be built
+     * @param[filled] into The vector to store the built device in
+     */
+    static void buildVehicleDevices(SUMOVehicle& v, std::vector<MSDevice*>& into);
+
+
+    /** @brief Prepares the given network for the next iteration
+     *
+     * Computes the mean edge travel times measured within the finished
+     *  iteration (finishIteration), writes the final outputs of the finished
+     *  iteration and continues the file outputs in new files with the suffix
+     *  "_<ITERATION>" (e.g. "tripinfo_001.xml"). Resets the network to the
+     *  begin time and builds the vehicles remembered in the first iteration anew.
+     *
+     * @param[in] net The network to reuse
+     * @param[in] begin The begin time of the simulation
+     * @exception ProcessError If the network state cannot be reset
+     * @exception IOError If an output file could not be built
+     */
+    static void nextIteration(MSNet& net, SUMOTime begin);
+
+
+    /** @brief Ends the current iteration
+     *
+     * Computes the mean edge travel times measured within the iteration which
+     *  are used by the routers within the next one.
+     */
+    static void finishIteration();
+
+
+    /** @brief Deletes the vehicle definitions, route alternatives and travel times kept over the iterations
+     *
+     * Must be called before the network is deleted as the remembered routes
+     *  are released.
+     */
+    static void cleanup();
+
+
+#ifdef HAVE_FOX
+    /// @brief Waits for the route choices computed in parallel and gives the chosen routes to the vehicles
+    static void waitForAll();
+#endif
+
+
+    /// @name Route choice and travel time aggregation (static for testing)
+    /// @{
+
+    /** @brief Adds the given route to the alternatives unless it is empty or known
+     * @param[in, filled] routes The known alternatives
+     * @param[in] edges The route to add
+     * @return Whether the route was added
+     */
+    static bool addAlternative(std::vector<RouteAlternative>& routes, const ConstMSEdgeVector& edges);
+
+
+    /** @brief Updates the costs and probabilities of the alternatives
+     *
+     * If a new route was added (as the last alternative), it gets the
+     *  probability 1/n while the probabilities of the others are scaled
+     *  accordingly. The costs are given to the calculator which computes
+     *  the probabilities. Routes with a probability of 0 are removed unless
+     *  the calculator keeps all routes and the alternatives are pruned to
+     *  the maximum number keeping the most probable ones.
+     *
+     * @param[in, changed] routes The known alternatives
+     * @param[in] costs The current costs of the alternatives
+     * @param[in] newRoute Whether the last alternative was added just now
+     * @param[in] lastUsed The index of the alternative used in the previous iteration
+     * @param[in] calculator The calculator to use
+     * @param[in] veh The vehicle the alternatives belong to
+     * @param[in] time The departure time
+     */
+    static void updateAlternatives(std::vector<RouteAlternative>& routes, const std::vector<SUMOReal>& costs,
+                                   const bool newRoute, const int lastUsed, Calculator& calculator,
+                                   const SUMOVehicle* const veh, const SUMOTime time);
+
+
+    /** @brief Returns the index of the alternative matching the given random number
+     * @param[in] routes The alternatives with their probabilities
+     * @param[in] random A random number in [0, 1)
+     * @return The index of the chosen alternative
+     */
+    static int chooseAlternative(const std::vector<RouteAlternative>& routes, SUMOReal random);
+
+
+    /** @brief Adds a measured travel time of an edge
+     * @param[in] edgeID The numerical id of the edge
+     * @param[in] interval The index of the aggregation interval the edge was entered in
+     * @param[in] travelTime The measured travel time in seconds
+     */
+    static void addMeasurement(const int edgeID, const int interval, const SUMOReal travelTime);
+
+
+    /** @brief Returns the mean travel time measured in the previous iteration
+     * @param[in] edgeID The numerical id of the edge
+     * @param[in] interval The index of the aggregation interval
+     * @return The mean travel time in seconds, -1 if nothing was measured
+     */
+    static SUMOReal getMeasuredTravelTime(const int edgeID, const int interval);
+
+
+    /** @brief Returns the travel time of an edge as assumed by the assignment
+     *
+     * The travel time measured in the previous iteration is used if known,
+     *  the one known to the network otherwise.
+     *
+     * @param[in] e The edge for which the travel time shall be returned
+     * @param[in] v The vehicle that is routed
+     * @param[in] t The time the edge is entered in seconds
+     * @return The travel time in seconds
+     * @see MSNet::getTravelTime
+     */
+    static SUMOReal getTravelTime(const MSEdge* const e, const SUMOVehicle* const v, SUMOReal t);
+    /// @}
+
+
+
+public:
+    /// @brief Destructor.
+    ~MSDevice_DUA();
+
+
+
+    /// @name Methods called on vehicle movement / state change, overwriting MSDevice
+    /// @{
+
+    /** @brief Remembers the edge the vehicle enters and the time it does so
+     *
+     * @param[in] veh The entering vehicle.
+     * @param[in] reason how the vehicle enters the lane
+     * @return Always true
+     * @see MSMoveReminder::notifyEnter
+     * @see MSMoveReminder::Notification
+     */
+    bool notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification reason);
+
+
+    /** @brief Measures the travel time of the edge left
+     *
+     * Only edges which were entered and left via a junction are measured.
+     *
+     * @param[in] veh The leaving vehicle.
+     * @param[in] lastPos Position on the lane when leaving.
+     * @param[in] reason how the vehicle leaves the lane
+     * @return Always true
+     * @see MSMoveReminder::notifyLeave
+     */
+    bool notifyLeave(SUMOVehicle& veh, SUMOReal lastPos,
+                     MSMoveReminder::Notification reason);
+    /// @}
+
+
+
+private:
+#ifdef HAVE_FOX
+    /**
+     * @class WorkerThread
+     * @brief the thread which provides the router instance as context
+     */
+    class WorkerThread : public FXWorkerThread {
+    public:
+        WorkerThread(FXWorkerThread::Pool& pool,
+                     SUMOAbstractRouter<MSEdge, SUMOVehicle>* router)
+            : FXWorkerThread(pool), myRouter(router) {}
+        SUMOAbstractRouter<MSEdge, SUMOVehicle>& getRouter() const {
+            return *myRouter;
+        }
+        virtual ~WorkerThread() {
+            stop();
+            delete myRouter;
+        }
+    private:
+        SUMOAbstractRouter<MSEdge, SUMOVehicle>* myRouter;
+    };
+
+    /**
+     * @class RouteChoiceTask
+     * @brief the task which chooses the route of a vehicle
+     */
+    class RouteChoiceTask : public FXWorkerThread::Task {
+    public:
+        RouteChoiceTask(MSDevice_DUA& device, const SUMOTime time)
+            : myDevice(device), myTime(time) {}
+        void run(FXWorkerThread* context);
+    private:
+        MSDevice_DUA& myDevice;
+        const SUMOTime myTime;
+    private:
+        /// @brief Invalidated assignment operator.
+        RouteChoiceTask& operator=(const RouteChoiceTask&);
+    };
+#endif
+
+
+    /// @brief Used for sorting route alternatives by their probability (highest first)
+    class probability_comparator {
+    public:
+        bool operator()(const RouteAlternative& a1, const RouteAlternative& a2) const {
+            return a1.getProbability() > a2.getProbability();
+        }
+    };
+
+
+    /// @brief The definition of a vehicle taking part in the assignment with its route alternatives
+    struct AssignedVehicle {
+        /// @brief The vehicle's parameters at its first departure
+        SUMOVehicleParameter* pars;
+        /// @brief The route the vehicle was loaded with (referenced)
+        const MSRoute* route;
+        /// @brief The vehicle's type
+        const MSVehicleType* type;
+        /// @brief The vehicle's chosen speed factor
+        SUMOReal speedFactor;
+        /// @brief The routes known for the vehicle
+        std::vector<RouteAlternative> routes;
+        /// @brief The index of the route driven in the last iteration
+        int lastUsed;
+    };
+
+
+    /** @brief Constructor
+     *
+     * @param[in] holder The vehicle that holds this device
+     * @param[in] id The ID of the device
+     */
+    MSDevice_DUA(SUMOVehicle& holder, const std::string& id);
+
+
+    /** @brief Chooses the route of the vehicle before its insertion
+     *
+     * Executed once at the vehicle's departure time. Within the first
+     *  iteration, the vehicle is remembered. Later on, the choice is
+     *  computed directly or given to the thread pool.
+     *
+     * @param[in] currentTime The current simulation time
+     * @return Always 0 (the command is not repeated)
+     */
+    SUMOTime chooseRoute(SUMOTime currentTime);
+
+
+    /** @brief Updates the alternatives and chooses the one to drive
+     *
+     * Computes the route to use but does not give it to the vehicle (see
+     *  applyChoice) as replacing routes is not thread-safe.
+     *
+     * @param[in] router The router to use
+     * @param[in] currentTime The current simulation time
+     */
+    void choose(SUMOAbstractRouter<MSEdge, SUMOVehicle>& router, const SUMOTime currentTime);
+
+
+    /// @brief Lets the vehicle drive the chosen route if it differs from the current one
+    void applyChoice();
+
+
+    /// @brief Builds a router using the travel times of the assignment
+    static SUMOAbstractRouter<MSEdge, SUMOVehicle>* buildRouter();
+
+
+
+private:
+    /// @brief The command choosing the route (0 once executed)
+    WrappingCommand<MSDevice_DUA>* myChoiceCommand;
+
+    /// @brief The index of the vehicle's definition in myVehicles, -1 if unknown
+    int myIndex;
+
+    /// @brief The route chosen to be driven, empty if the current one shall be kept
+    ConstMSEdgeVector myChosenEdges;
+
+    /// @brief The edge entered via a junction which is currently measured, 0 if none
+    const MSEdge* myEntryEdge;
+
+    /// @brief The time the measured edge was entered
+    SUMOTime myEntryTime;
+
+
+    /// @brief The index of the current iteration
+    static int myIteration;
+
+    /// @brief The length of the intervals travel times are aggregated in
+    static SUMOTime myAggregation;
+
+    /// @brief The summed travel times and their number per edge (numerical id) and interval of the current iteration
+    static std::vector<std::vector<std::pair<SUMOReal, int> > > myMeasurements;
+
+    /// @brief The mean travel times per edge (numerical id) and interval of the previous iteration, negative if unknown
+    static std::vector<std::vector<SUMOReal> > myTravelTimes;
+
+    /// @brief The vehicles remembered in the first iteration
+    static std::vector<AssignedVehicle> myVehicles;
+
+    /// @brief The router used without threads
+    static SUMOAbstractRouter<MSEdge, SUMOVehicle>* myRouter;
+
+#ifdef HAVE_FOX
+    /// @brief The pool of threads computing the route choices
+    static FXWorkerThread::Pool myThreadPool;
+
+    /// @brief The devices whose choice is computed by the threads
+    static std::vector<MSDevice_DUA*> myPendingChoices;
+
+    /// @brief The mutex guarding the calculator (which may keep state)
+    static FXMutex myCalculatorMutex;
+#endif
+
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    MSDevice_DUA(const MSDevice_DUA&);
+
+    /// @brief Invalidated assignment operator.
+    MSDevice_DUA& operator=(const MSDevice_DUA&);
+
+
+};
+
+
+#endif
+
+/****************************************************************************/
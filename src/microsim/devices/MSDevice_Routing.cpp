@@ -37,6 +37,7 @@
 #include <microsim/MSEdge.h>
 #include <microsim/MSEdgeControl.h>
 #include <microsim/MSGlobals.h>
+#include <microsim/MSStepProfiler.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/common/WrappingCommand.h>
 #include <utils/common/StaticCommand.h>
@@ -44,6 +45,7 @@
 #include <utils/vehicle/AStarRouter.h>
 #include <utils/vehicle/CHRouter.h>
 #include <utils/vehicle/CHRouterWrapper.h>
+#include <utils/vehicle/RouteCache.h>
 
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
@@ -55,14 +57,15 @@
 // ===========================================================================
 std::vector<SUMOReal> MSDevice_Routing::myEdgeSpeeds;
 std::vector<std::vector<SUMOReal> > MSDevice_Routing::myPastEdgeSpeeds;
-Command* MSDevice_Routing::myEdgeWeightSettingCommand = 0;
+StaticCommand<MSDevice_Routing>* MSDevice_Routing::myEdgeWeightSettingCommand = 0;
 SUMOReal MSDevice_Routing::myAdaptationWeight;
 int MSDevice_Routing::myAdaptationSteps;
 int MSDevice_Routing::myAdaptationStepsIndex = 0;
 SUMOTime MSDevice_Routing::myAdaptationInterval = -1;
 SUMOTime MSDevice_Routing::myLastAdaptation = -1;
 bool MSDevice_Routing::myWithTaz;
-std::map<std::pair<const MSEdge*, const MSEdge*>, const MSRoute*> MSDevice_Routing::myCachedRoutes;
+bool MSDevice_Routing::myUseCache = false;
+RouteCache<MSEdge> MSDevice_Routing::myRouteCache;
 SUMOAbstractRouter<MSEdge, SUMOVehicle>* MSDevice_Routing::myRouter = 0;
 AStarRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >* MSDevice_Routing::myRouterWithProhibited = 0;
 SUMOReal MSDevice_Routing::myRandomizeWeightsFactor = 0;
@@ -106,6 +109,9 @@ MSDevice_Routing::insertOptions(OptionsCont& oc) {
     oc.addSynonyme("device.rerouting.with-taz", "with-taz");
     oc.addDescription("device.rerouting.with-taz", "Routing", "Use zones (districts) as routing start- and endpoints");
 
+    oc.doRegister("device.rerouting.cache", new Option_Bool(false));
+    oc.addDescription("device.rerouting.cache", "Routing", "Reuse the routes found for the same origin, destination and vehicle class until the edge weights are updated (always done with device.rerouting.with-taz)");
+
     oc.doRegister("device.rerouting.init-with-loaded-weights", new Option_Bool(false));
     oc.addDescription("device.rerouting.init-with-loaded-weights", "Routing", "Use weight files given with option --weight-files for initializing edge weights");
 
@@ -148,6 +154,7 @@ MSDevice_Routing::buildVehicleDevices(SUMOVehicle& v, std::vector<MSDevice*>& in
     if (needRerouting) {
         // route computation is enabled
         myWithTaz = oc.getBool("device.rerouting.with-taz");
+        myUseCache = myWithTaz || oc.getBool("device.rerouting.cache");
         const SUMOTime period = string2time(oc.getString("device.rerouting.period"));
         const SUMOTime prePeriod = string2time(oc.getString("device.rerouting.pre-period"));
         // initialise edge efforts if not done before
@@ -259,20 +266,6 @@ MSDevice_Routing::preInsertionReroute(const SUMOTime currentTime) {
     if (mySkipRouting == currentTime) {
         return DELTA_T;
     }
-    const MSEdge* source = *myHolder.getRoute().begin();
-    const MSEdge* dest = myHolder.getRoute().getLastEdge();
-    if (source->getPurpose() == MSEdge::EDGEFUNCTION_DISTRICT && dest->getPurpose() == MSEdge::EDGEFUNCTION_DISTRICT) {
-        const std::pair<const MSEdge*, const MSEdge*> key = std::make_pair(source, dest);
-        if (myCachedRoutes.find(key) != myCachedRoutes.end()) {
-            if (myCachedRoutes[key]->size() > 2) {
-                myHolder.replaceRoute(myCachedRoutes[key], true);
-                return myPreInsertionPeriod;
-            } else {
-                WRITE_WARNING("No route for vehicle '" + myHolder.getID() + "' found.");
-                return myPreInsertionPeriod;
-            }
-        }
-    }
     reroute(currentTime, true);
     return myPreInsertionPeriod;
 }
@@ -310,11 +303,7 @@ MSDevice_Routing::adaptEdgeEfforts(SUMOTime currentTime) {
     if (MSNet::getInstance()->getVehicleControl().getDepartedVehicleNo() == 0) {
         return myAdaptationInterval;
     }
-    std::map<std::pair<const MSEdge*, const MSEdge*>, const MSRoute*>::iterator it = myCachedRoutes.begin();
-    for (; it != myCachedRoutes.end(); ++it) {
-        it->second->release();
-    }
-    myCachedRoutes.clear();
+    myRouteCache.invalidate();
     const MSEdgeVector& edges = MSNet::getInstance()->getEdgeControl().getEdges();
     if (myAdaptationSteps > 0) {
         // moving average
@@ -363,6 +352,7 @@ MSDevice_Routing::reroute(const SUMOTime currentTime, const bool onInit) {
         return;
     }
     myLastRouting = currentTime;
+    MSStepProfiler::addReroute();
 #ifdef HAVE_FOX
     const bool needThread = (myRouter == 0 && myThreadPool.isFull());
 #else
@@ -413,6 +403,10 @@ MSDevice_Routing::reroute(const SUMOTime currentTime, const bool onInit) {
         } else {
             throw ProcessError("Unknown routing algorithm '" + routingAlgorithm + "'!");
         }
+        if (myUseCache) {
+            // the efforts do not depend on the time, so there is a single time slot
+            myRouter = new CachedRouter<MSEdge, SUMOVehicle>(myRouter, myRouteCache, 0);
+        }
     }
 #ifdef HAVE_FOX
     if (needThread) {
@@ -445,10 +439,18 @@ MSDevice_Routing::getRouterTT(const MSEdgeVector& prohibited) {
 
 
 
+std::string
+MSDevice_Routing::getRouteCacheStatistics() {
+    return myRouteCache.getStatistics();
+}
+
+
 void
 MSDevice_Routing::cleanup() {
     delete myRouterWithProhibited;
     myRouterWithProhibited = 0;
+    // the cached routes refer to the edges of the network which is deleted
+    myRouteCache.invalidate();
 #ifdef HAVE_FOX
     if (myThreadPool.size() > 0) {
         // we cannot wait for the static destructor to do the cleanup
@@ -464,6 +466,21 @@ MSDevice_Routing::cleanup() {
 }
 
 
+void
+MSDevice_Routing::clearState() {
+    if (myEdgeWeightSettingCommand != 0) {
+        // the command is deleted by the event control
+        myEdgeWeightSettingCommand->deschedule();
+        myEdgeWeightSettingCommand = 0;
+    }
+    myEdgeSpeeds.clear();
+    myPastEdgeSpeeds.clear();
+    myAdaptationInterval = -1;
+    myAdaptationStepsIndex = 0;
+    myRouteCache.invalidate();
+}
+
+
 #ifdef HAVE_FOX
 void
 MSDevice_Routing::waitForAll() {
@@ -479,17 +496,6 @@ MSDevice_Routing::waitForAll() {
 void
 MSDevice_Routing::RoutingTask::run(FXWorkerThread* context) {
     myVehicle.reroute(myTime, static_cast<WorkerThread*>(context)->getRouter(), myOnInit, myWithTaz);
-    const MSEdge* source = *myVehicle.getRoute().begin();
-    const MSEdge* dest = myVehicle.getRoute().getLastEdge();
-    if (source->getPurpose() == MSEdge::EDGEFUNCTION_DISTRICT && dest->getPurpose() == MSEdge::EDGEFUNCTION_DISTRICT) {
-        const std::pair<const MSEdge*, const MSEdge*> key = std::make_pair(source, dest);
-        lock();
-        if (MSDevice_Routing::myCachedRoutes.find(key) == MSDevice_Routing::myCachedRoutes.end()) {
-            MSDevice_Routing::myCachedRoutes[key] = &myVehicle.getRoute();
-            myVehicle.getRoute().addReference();
-        }
-        unlock();
-    }
 }
 #endif
 
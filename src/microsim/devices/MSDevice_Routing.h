@@ -37,6 +37,7 @@
 #include <map>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/WrappingCommand.h>
+#include <utils/common/StaticCommand.h>
 #include <utils/vehicle/SUMOAbstractRouter.h>
 #include <utils/vehicle/AStarRouter.h>
 #include <microsim/MSVehicle.h>
@@ -51,6 +52,7 @@
 // class declarations
 // ===========================================================================
 class MSLane;
+template<class E> class RouteCache;
 
 // ===========================================================================
 // class definitions
@@ -109,6 +111,16 @@ public:
     /// @brief deletes the router instance
     static void cleanup();
 
+    /** @brief Forgets the edge weights and stops their adaptation
+     *
+     * Used when the simulation is reset, the weights are initialised
+     *  anew when the next device is built.
+     */
+    static void clearState();
+
+    /// @brief returns the hit rate of the route cache for the statistics output, "" if unused
+    static std::string getRouteCacheStatistics();
+
     /// @brief returns whether any routing actions take place
     static bool isEnabled() {
         return !myWithTaz && !myEdgeSpeeds.empty();
@@ -318,7 +330,7 @@ private:
     WrappingCommand< MSDevice_Routing >* myRerouteCommand;
 
     /// @brief The weights adaptation/overwriting command
-    static Command* myEdgeWeightSettingCommand;
+    static StaticCommand<MSDevice_Routing>* myEdgeWeightSettingCommand;
 
     /// @brief The container of edge speeds
     static std::vector<SUMOReal> myEdgeSpeeds;
@@ -344,8 +356,11 @@ private:
     /// @brief whether taz shall be used at initial rerouting
     static bool myWithTaz;
 
-    /// @brief The container of pre-calculated routes
-    static std::map<std::pair<const MSEdge*, const MSEdge*>, const MSRoute*> myCachedRoutes;
+    /// @brief whether routes found shall be reused for the same origin, destination and vehicle class
+    static bool myUseCache;
+
+    /// @brief The routes found since the last edge weight adaptation
+    static RouteCache<MSEdge> myRouteCache;
 
     /// @brief The router to use
     static SUMOAbstractRouter<MSEdge, SUMOVehicle>* myRouter;
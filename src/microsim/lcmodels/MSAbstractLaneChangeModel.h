@@ -33,6 +33,7 @@
 #include <config.h>
 #endif
 
+#include <utils/common/MemoryPool.h>
 #include <microsim/MSVehicle.h>
 
 class MSLane;
@@ -145,6 +146,18 @@ public:
     /// @brief Destructor
     virtual ~MSAbstractLaneChangeModel();
 
+#ifndef CHECK_MEMORY_LEAKS
+    /// @brief Lane change models are allocated from the MemoryPool
+    static void* operator new(size_t size) {
+        return MemoryPool::allocate(size);
+    }
+
+    /// @brief Lane change models return their memory to the MemoryPool
+    static void operator delete(void* p, size_t size) {
+        MemoryPool::deallocate(p, size);
+    }
+#endif
+
     inline int getOwnState() const {
         return myOwnState;
     }
@@ -67,7 +67,23 @@ MSDetectorControl::close(SUMOTime step) {
     // flush the last values
     writeOutput(step, true);
     // [...] files are closed on another place [...]
-    myIntervals.clear();
+}
+
+
+void
+MSDetectorControl::clearState() {
+    for (std::map<IntervalsKey, SUMOTime>::iterator i = myLastCalls.begin(); i != myLastCalls.end(); ++i) {
+        i->second = i->first.second;
+    }
+    for (std::map<SumoXMLTag, NamedObjectCont<MSDetectorFileOutput*> >::const_iterator i = myDetectors.begin(); i != myDetectors.end(); ++i) {
+        const std::map<std::string, MSDetectorFileOutput*>& dets = i->second.getMyMap();
+        for (std::map<std::string, MSDetectorFileOutput*>::const_iterator j = dets.begin(); j != dets.end(); ++j) {
+            (*j).second->reset();
+        }
+    }
+    for (std::vector<MSMeanData*>::const_iterator i = myMeanData.begin(); i != myMeanData.end(); ++i) {
+        (*i)->reset();
+    }
 }
 
 
@@ -82,6 +82,14 @@ public:
     void close(SUMOTime step);
 
 
+    /** @brief Restarts the detector outputs at their begin
+     *
+     * Used when the simulation time is reset. All detectors are reset and the
+     *  next intervals are written relative to their begin times again.
+     */
+    void clearState();
+
+
     /** @brief Adds a detector/output combination into the containers
      *
      * The detector is tried to be added into "myDetectors". If the detector
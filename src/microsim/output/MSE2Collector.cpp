@@ -70,6 +70,7 @@ MSE2Collector::MSE2Collector(const std::string& id, DetectorUsage usage,
     assert(myLane != 0);
     assert(myStartPos >= 0 && myStartPos < myLane->getLength());
     assert(myEndPos - myStartPos > 0 && myEndPos <= myLane->getLength());
+    myNotifyMoveBegin = myStartPos;
     reset();
 }
 
@@ -94,6 +95,7 @@ MSE2Collector::MSE2Collector(const std::string& id, DetectorUsage usage,
     assert(myLane != 0);
     assert(myStartPos >= 0 && myStartPos < myLane->getLength());
     assert(myEndPos - myStartPos > 0 && myEndPos <= myLane->getLength());
+    myNotifyMoveBegin = myStartPos;
     reset();
 }
 
@@ -51,7 +51,9 @@
 MSE3Collector::MSE3EntryReminder::MSE3EntryReminder(
     const MSCrossSection& crossSection, MSE3Collector& collector) :
     MSMoveReminder(collector.getID() + "_entry", crossSection.myLane),
-    myCollector(collector), myPosition(crossSection.myPosition) {}
+    myCollector(collector), myPosition(crossSection.myPosition) {
+    myNotifyMoveBegin = myPosition;
+}
 
 
 bool
@@ -92,7 +94,9 @@ MSE3Collector::MSE3EntryReminder::notifyLeave(SUMOVehicle& veh, SUMOReal, MSMove
 MSE3Collector::MSE3LeaveReminder::MSE3LeaveReminder(
     const MSCrossSection& crossSection, MSE3Collector& collector) :
     MSMoveReminder(collector.getID() + "_exit", crossSection.myLane),
-    myCollector(collector), myPosition(crossSection.myPosition) {}
+    myCollector(collector), myPosition(crossSection.myPosition) {
+    myNotifyMoveBegin = myPosition;
+}
 
 
 bool
@@ -67,6 +67,7 @@ MSInductLoop::MSInductLoop(const std::string& id, MSLane* const lane,
     myVehicleDataCont(),
     myVehiclesOnDet() {
     assert(myPosition >= 0 && myPosition <= myLane->getLength());
+    myNotifyMoveBegin = myPosition;
     reset();
 }
 
@@ -61,6 +61,7 @@ MSInstantInductLoop::MSInstantInductLoop(const std::string& id,
     myOutputDevice(od),
     myPosition(positionInMeters), myLastExitTime(-1) {
     assert(myPosition >= 0 && myPosition <= myLane->getLength());
+    myNotifyMoveBegin = myPosition;
     writeXMLDetectorProlog(od);
 }
 
@@ -409,6 +409,12 @@ MSMeanData::resetOnly(SUMOTime stopTime) {
 }
 
 
+void
+MSMeanData::reset() {
+    resetOnly(MSNet::getInstance()->getCurrentTimeStep());
+}
+
+
 std::string
 MSMeanData::getEdgeID(const MSEdge* const edge) {
     return edge->getID();
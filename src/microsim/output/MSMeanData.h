@@ -351,6 +351,11 @@ public:
      * @exception IOError If an error on writing occurs (!!! not yet implemented)
      */
     virtual void writeXMLDetectorProlog(OutputDevice& dev) const;
+
+    /** @brief Resets the collected values
+     * @see MSDetectorFileOutput::reset
+     */
+    void reset();
     /// @}
 
     /** @brief Updates the detector
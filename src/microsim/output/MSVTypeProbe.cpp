@@ -103,4 +103,10 @@ MSVTypeProbe::execute(SUMOTime currentTime) {
 }
 
 
+SUMOTime
+MSVTypeProbe::shiftTime(SUMOTime /* currentTime */, SUMOTime /* execTime */, SUMOTime newTime) {
+    return newTime;
+}
+
+
 /****************************************************************************/
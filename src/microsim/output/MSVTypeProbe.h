@@ -89,6 +89,19 @@ public:
      * @see Command
      */
     SUMOTime execute(SUMOTime currentTime);
+
+
+    /** @brief Reschedules the output when the simulation time is reset
+     *
+     * The output continues at the new time.
+     *
+     * @param[in] currentTime The current simulation time (unused)
+     * @param[in] execTime The time the command is scheduled for (unused)
+     * @param[in] newTime The time the simulation continues at
+     * @return The time the simulation continues at
+     * @see Command::shiftTime
+     */
+    SUMOTime shiftTime(SUMOTime currentTime, SUMOTime execTime, SUMOTime newTime);
     /// @}
 
 
@@ -192,6 +192,18 @@ public:
         UNUSED_PARAMETER(step);
         UNUSED_PARAMETER(stepDuration);
     }
+
+
+    /** @brief Restarts the program
+     *
+     * The program has no state, it is switched at once.
+     * @param[in] simStep The time the simulation continues at
+     * @return The time of the next switch
+     * @see MSTrafficLightLogic::clearState
+     */
+    SUMOTime clearState(SUMOTime simStep) {
+        return simStep;
+    }
     /// @}
 
 
@@ -57,7 +57,9 @@ MSSimpleTrafficLightLogic::MSSimpleTrafficLightLogic(MSTLLogicControl& tlcontrol
         const std::map<std::string, std::string>& parameters) :
     MSTrafficLightLogic(tlcontrol, id, subid, delay, parameters),
     myPhases(phases),
-    myStep(step) {
+    myStep(step),
+    myInitialStep(step),
+    myInitialDuration(delay - MSNet::getInstance()->getCurrentTimeStep()) {
     for (int i = 0; i < (int)myPhases.size(); i++) {
         myDefaultCycleTime += myPhases[i]->duration;
     }
@@ -207,6 +209,17 @@ MSSimpleTrafficLightLogic::changeStepAndDuration(MSTLLogicControl& tlcontrol,
 }
 
 
+SUMOTime
+MSSimpleTrafficLightLogic::clearState(SUMOTime simStep) {
+    myStep = myInitialStep;
+    myCurrentDurationIncrement = -1;
+    for (int i = 0; i < (int)myPhases.size(); i++) {
+        myPhases[i]->myLastSwitch = simStep;
+    }
+    return simStep + myInitialDuration;
+}
+
+
 void
 MSSimpleTrafficLightLogic::setPhases(const Phases& phases, int step) {
     assert(step < (int)phases.size());
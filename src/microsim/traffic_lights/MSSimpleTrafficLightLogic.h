@@ -191,6 +191,13 @@ public:
     void changeStepAndDuration(MSTLLogicControl& tlcontrol, SUMOTime simStep,
                                int step, SUMOTime stepDuration);
 
+    /** @brief Restarts the program with the phase and the duration it was loaded with
+     * @param[in] simStep The time the simulation continues at
+     * @return The time of the next switch
+     * @see MSTrafficLightLogic::clearState
+     */
+    SUMOTime clearState(SUMOTime simStep);
+
     /** @brief Replaces the phases and set the phase index
      */
     void setPhases(const Phases& phases, int index);
@@ -204,6 +211,12 @@ protected:
     /// @brief The current step
     int myStep;
 
+    /// @brief The step the program was loaded with
+    const int myInitialStep;
+
+    /// @brief The remaining duration of the initial step when the program was loaded
+    const SUMOTime myInitialDuration;
+
 
 private:
     /// @brief frees memory responsibilities
@@ -573,6 +573,15 @@ MSTLLogicControl::setTrafficLightSignals(SUMOTime t) const {
 }
 
 
+void
+MSTLLogicControl::clearState(SUMOTime t) {
+    // the programs were restarted by their switch commands
+    for (std::map<std::string, TLSLogicVariants*>::const_iterator i = myLogics.begin(); i != myLogics.end(); ++i) {
+        (*i).second->getActive()->setTrafficLightSignals(t);
+    }
+}
+
+
 std::vector<MSTrafficLightLogic*>
 MSTLLogicControl::getAllLogics() const {
     std::vector<MSTrafficLightLogic*> ret;
@@ -207,6 +207,17 @@ public:
     void setTrafficLightSignals(SUMOTime t) const;
 
 
+    /** @brief Applies the signals of the running (current) tls programs after a reset
+     *
+     * The programs themselves are restarted when their switch commands are
+     *  rescheduled (see MSEventControl::clearState).
+     *
+     * @param[in] t The time the simulation continues at
+     * @see MSTrafficLightLogic::clearState
+     */
+    void clearState(SUMOTime t);
+
+
     /** @brief Returns a vector which contains all logics
      *
      * All logics are included, active (current) and non-active
@@ -106,6 +106,20 @@ MSTrafficLightLogic::SwitchCommand::deschedule(MSTrafficLightLogic* tlLogic) {
 }
 
 
+SUMOTime
+MSTrafficLightLogic::SwitchCommand::shiftTime(SUMOTime /* currentTime */, SUMOTime /* execTime */, SUMOTime newTime) {
+    if (!myAmValid) {
+        return -1;
+    }
+    const SUMOTime next = myTLLogic->clearState(newTime);
+    if (next < 0) {
+        throw ProcessError("The program '" + myTLLogic->getProgramID() + "' of traffic light '" + myTLLogic->getID() + "' cannot be restarted.");
+    }
+    myAssumedNextSwitch = next;
+    return next;
+}
+
+
 /* -------------------------------------------------------------------------
  * member method definitions
  * ----------------------------------------------------------------------- */
@@ -328,6 +328,18 @@ public:
     virtual void changeStepAndDuration(MSTLLogicControl& tlcontrol,
                                        SUMOTime simStep, int step, SUMOTime stepDuration) = 0;
 
+
+    /** @brief Restarts the program as if it was loaded at the given time
+     *
+     * Called by the switch command when the simulation is reset. The default
+     *  implementation does not support this.
+     * @param[in] simStep The time the simulation continues at
+     * @return The time of the next switch, -1 if the program cannot be restarted
+     */
+    virtual SUMOTime clearState(SUMOTime /* simStep */) {
+        return -1;
+    }
+
     /// @}
 
 
@@ -363,6 +375,17 @@ protected:
         void deschedule(MSTrafficLightLogic* tlLogic);
 
 
+        /** @brief Restarts the logic when the simulation time is reset
+         * @param[in] currentTime The current simulation time
+         * @param[in] execTime The time the command is scheduled for
+         * @param[in] newTime The time the simulation continues at
+         * @return The next switch time of the restarted logic, -1 if the command is invalid
+         * @exception ProcessError If the logic cannot be restarted
+         * @see MSTrafficLightLogic::clearState
+         */
+        SUMOTime shiftTime(SUMOTime currentTime, SUMOTime execTime, SUMOTime newTime);
+
+
         /** @brief Returns the assumed next switch time
          * @return The assumed next switch time
          */
@@ -48,7 +48,7 @@
 // method definitions
 // ===========================================================================
 ODDistrict::ODDistrict(const std::string& id)
-    : Named(id) {}
+    : Named(id), mySources(true), mySinks(true) {}
 
 
 ODDistrict::~ODDistrict() {}
@@ -66,6 +66,13 @@ ODDistrict::addSink(const std::string& id, SUMOReal weight) {
 }
 
 
+void
+ODDistrict::close() {
+    mySources.buildAliasTable();
+    mySinks.buildAliasTable();
+}
+
+
 std::string
 ODDistrict::getRandomSource() const {
     return mySources.get();
@@ -94,6 +94,13 @@ public:
     void addSink(const std::string& id, SUMOReal weight);
 
 
+    /** @brief Prepares choosing the sources and sinks
+     *
+     * Has to be called after the last source and sink was added.
+     */
+    void close();
+
+
     /** @brief Returns the id of a source to use
      *
      * If the list of this district's sources is empty, an OutOfBoundsException
@@ -108,6 +108,7 @@ ODDistrictCont::makeDistricts(const std::map<std::string, std::pair<std::vector<
         for (std::vector<std::string>::const_iterator i = sinks.begin(); i != sinks.end(); ++i) {
             current->addSink(*i, 1.);
         }
+        current->close();
         add(current->getID(), current);
     }
 }
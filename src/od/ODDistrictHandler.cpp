@@ -152,6 +152,7 @@ ODDistrictHandler::parseTAZ(const SUMOSAXAttributes& attrs) {
 void
 ODDistrictHandler::closeDistrict() {
     if (myCurrentDistrict != 0) {
+        myCurrentDistrict->close();
         myContainer.add(myCurrentDistrict->getID(), myCurrentDistrict);
     }
 }
@@ -34,6 +34,7 @@
 #include <iostream>
 #include <algorithm>
 #include <list>
+#include <queue>
 #include <iterator>
 #include <utils/options/OptionsCont.h>
 #include <utils/common/StdDefs.h>
@@ -162,7 +163,18 @@ ODMatrix::computeDeparts(ODCell* cell,
     if (vehicles2insert == 0) {
         return cell->vehicleNumber;
     }
+    // resolve the districts once for all vehicles of this cell
+    const ODDistrict* const origin = myDistricts.get(cell->origin);
+    if (origin == 0) {
+        throw InvalidArgument("There is no district '" + cell->origin + "'.");
+    }
+    const ODDistrict* const destination = myDistricts.get(cell->destination);
+    if (destination == 0) {
+        throw InvalidArgument("There is no district '" + cell->destination + "'.");
+    }
+    const bool canDiffer = origin->sourceNumber() > 1 || destination->sinkNumber() > 1;
 
+    into.reserve(into.size() + vehicles2insert);
     const SUMOReal offset = (SUMOReal)(cell->end - cell->begin) / (SUMOReal) vehicles2insert / (SUMOReal) 2.;
     for (int i = 0; i < vehicles2insert; ++i) {
         ODVehicle veh;
@@ -173,10 +185,9 @@ ODMatrix::computeDeparts(ODCell* cell,
         } else {
             veh.depart = (SUMOTime)RandHelper::rand(cell->begin, cell->end);
         }
-        const bool canDiffer = myDistricts.get(cell->origin)->sourceNumber() > 1 || myDistricts.get(cell->destination)->sinkNumber() > 1;
         do {
-            veh.from = myDistricts.getRandomSourceFromDistrict(cell->origin);
-            veh.to = myDistricts.getRandomSinkFromDistrict(cell->destination);
+            veh.from = origin->getRandomSource();
+            veh.to = destination->getRandomSink();
         } while (canDiffer && differSourceSink && (veh.to == veh.from));
         if (!canDiffer && differSourceSink && (veh.to == veh.from)) {
             WRITE_WARNING("Cannot find different source and sink edge for origin '" + cell->origin + "' and destination '" + cell->destination + "'.");
@@ -225,63 +236,72 @@ ODMatrix::write(SUMOTime begin, const SUMOTime end,
     if (myContainer.size() == 0) {
         return;
     }
-    std::map<std::pair<std::string, std::string>, SUMOReal> fractionLeft;
     int vehName = 0;
     sortByBeginTime();
-    // recheck begin time
-    begin = MAX2(begin, myContainer.front()->begin);
-    std::vector<ODCell*>::iterator next = myContainer.begin();
-    std::vector<ODVehicle> vehicles;
-    SUMOTime lastOut = -DELTA_T;
-    // go through the time steps
-    for (SUMOTime t = begin; t < end;) {
-        if (stepLog && t - lastOut >= DELTA_T) {
-            std::cout << "Parsing time " + time2string(t) << '\r';
-            lastOut = t;
+    const int numCells = (int)myContainer.size();
+    // link each cell to the next one of the same O/D pair which inherits its left fraction
+    std::vector<int> nextSameOD(numCells, -1);
+    std::map<std::pair<std::string, std::string>, int> lastSameOD;
+    for (int i = 0; i < numCells; ++i) {
+        const std::pair<std::string, std::string> odID = std::make_pair(myContainer[i]->origin, myContainer[i]->destination);
+        std::map<std::pair<std::string, std::string>, int>::iterator last = lastSameOD.find(odID);
+        if (last != lastSameOD.end()) {
+            nextSameOD[last->second] = i;
+            last->second = i;
+        } else {
+            lastSameOD[odID] = i;
         }
-        // recheck whether a new cell got valid
-        bool changed = false;
-        while (next != myContainer.end() && (*next)->begin <= t && (*next)->end > t) {
-            std::pair<std::string, std::string> odID = std::make_pair((*next)->origin, (*next)->destination);
-            // check whether the current cell must be extended by the last fraction
-            if (fractionLeft.find(odID) != fractionLeft.end()) {
-                (*next)->vehicleNumber += fractionLeft[odID];
-                fractionLeft[odID] = 0;
-            }
-            // get the new departures (into tmp)
-            const int oldSize = (int)vehicles.size();
-            const SUMOReal fraction = computeDeparts(*next, vehName, vehicles, uniform, differSourceSink, prefix);
-            if (oldSize != (int)vehicles.size()) {
-                changed = true;
+    }
+    lastSameOD.clear();
+    // the departures of each cell (latest first) and the cells which still have some, earliest first
+    std::vector<std::vector<ODVehicle> > departures(numCells);
+    std::priority_queue<std::vector<ODVehicle>*, std::vector<std::vector<ODVehicle>*>, later_cell_departure_comperator> active;
+    int next = 0;
+    SUMOTime lastOut = -DELTA_T;
+    while (true) {
+        // generate the departures of all cells which start before the next pending vehicle
+        while (next < numCells && myContainer[next]->begin < end
+                && (active.empty() || myContainer[next]->begin <= active.top()->back().depart)) {
+            ODCell* const cell = myContainer[next];
+            std::vector<ODVehicle>& cellDepartures = departures[next];
+            const SUMOReal fraction = computeDeparts(cell, vehName, cellDepartures, uniform, differSourceSink, prefix);
+            if (fraction != 0 && nextSameOD[next] >= 0) {
+                myContainer[nextSameOD[next]]->vehicleNumber += fraction;
             }
-            if (fraction != 0) {
-                fractionLeft[odID] = fraction;
+            if (!cellDepartures.empty()) {
+                sort(cellDepartures.begin(), cellDepartures.end(), descending_departure_comperator());
+                active.push(&cellDepartures);
             }
             ++next;
         }
-        if (changed) {
-            sort(vehicles.begin(), vehicles.end(), descending_departure_comperator());
-        }
-        for (std::vector<ODVehicle>::reverse_iterator i = vehicles.rbegin(); i != vehicles.rend() && (*i).depart == t; ++i) {
-            if (t >= begin) {
-                myNumWritten++;
-                dev.openTag(SUMO_TAG_TRIP).writeAttr(SUMO_ATTR_ID, (*i).id).writeAttr(SUMO_ATTR_DEPART, time2string(t));
-                dev.writeAttr(SUMO_ATTR_FROM, (*i).from).writeAttr(SUMO_ATTR_TO, (*i).to);
-                writeDefaultAttrs(dev, noVtype, i->cell);
-                dev.closeTag();
-            }
+        if (active.empty()) {
+            break;
         }
-        while (vehicles.size() != 0 && vehicles.back().depart == t) {
-            vehicles.pop_back();
+        // k-way merge: write the earliest pending vehicle
+        std::vector<ODVehicle>* const cellDepartures = active.top();
+        const ODVehicle& veh = cellDepartures->back();
+        const SUMOTime t = veh.depart;
+        if (t >= end) {
+            break;
         }
-        if (!vehicles.empty()) {
-            t = vehicles.back().depart;
+        active.pop();
+        if (stepLog && t - lastOut >= DELTA_T) {
+            std::cout << "Parsing time " + time2string(t) << '\r';
+            lastOut = t;
         }
-        if (next != myContainer.end() && (t > (*next)->begin || vehicles.empty())) {
-            t = (*next)->begin;
+        if (t >= begin) {
+            myNumWritten++;
+            dev.openTag(SUMO_TAG_TRIP).writeAttr(SUMO_ATTR_ID, veh.id).writeAttr(SUMO_ATTR_DEPART, time2string(t));
+            dev.writeAttr(SUMO_ATTR_FROM, veh.from).writeAttr(SUMO_ATTR_TO, veh.to);
+            writeDefaultAttrs(dev, noVtype, veh.cell);
+            dev.closeTag();
         }
-        if (next == myContainer.end() && vehicles.empty()) {
-            break;
+        cellDepartures->pop_back();
+        if (!cellDepartures->empty()) {
+            active.push(cellDepartures);
+        } else {
+            // release the memory of finished cells
+            std::vector<ODVehicle>().swap(*cellDepartures);
         }
     }
 }
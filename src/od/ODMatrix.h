@@ -139,19 +139,16 @@ public:
 
     /** @brief Writes the vehicles stored in the matrix assigning the sources and sinks
      *
-     * The cells stored in myContainer are sorted, first. Then, for each time
-     *  step to generate vehicles for, it is checked whether the topmost cell
-     *  is valid for this time step. If so, vehicles are generated from this
-     *  cell's description using "computeDeparts" and stored in an internal vector.
-     *  The pointer is moved and the check is repeated until the current cell
-     *  is not valid for the current time or no further cells exist.
+     * The cells stored in myContainer are sorted, first. The vehicles of a cell
+     *  are generated using "computeDeparts" as soon as the cell begins before
+     *  the earliest vehicle not written yet and stored sorted in a vector
+     *  per cell. The vehicles are then written in the order of their departure
+     *  by merging these vectors, so that only cells which are currently
+     *  active hold vehicles.
      *
-     * Then, for the current time step, the internal list of vehicles is sorted and
-     *  all vehicles that start within this time step are written.
-     *
-     * The left fraction of vehicles to insert is saved for each O/D-dependency
-     *  over time and the number of vehicles to generate is increased as soon
-     *  as this value is larger than 1, decrementing it.
+     * The left fraction of vehicles to insert is handed from each cell to the
+     *  next cell of the same O/D-dependency and increases the number of vehicles
+     *  to generate there.
      *
      * @param[in] begin The begin time to generate vehicles for
      * @param[in] end The end time to generate vehicles for
@@ -425,6 +422,32 @@ private:
 
     };
 
+
+    /**
+     * @class later_cell_departure_comperator
+     * @brief Used for keeping the departures of the active cells in a heap (earliest on top)
+     *
+     * Each element is the vector of vehicles of one cell sorted with
+     *  descending_departure_comperator, the next vehicle is at its back.
+     */
+    class later_cell_departure_comperator {
+    public:
+        /// @brief constructor
+        later_cell_departure_comperator() { }
+
+
+        /** @brief Comparing operator
+         *
+         * @param[in] p1 Departures of the first cell to compare
+         * @param[in] p2 Departures of the second cell to compare
+         * @return Whether the next vehicle of the first cell departs after the one of the second
+         */
+        bool operator()(const std::vector<ODVehicle>* p1, const std::vector<ODVehicle>* p2) const {
+            return descending_departure_comperator()(p1->back(), p2->back());
+        }
+
+    };
+
 private:
     /** @brief invalid copy constructor */
     ODMatrix(const ODMatrix& s);
@@ -207,21 +207,26 @@ ROLoader::processRoutes(const SUMOTime start, const SUMOTime end, const SUMOTime
     const SUMOTime firstStep = myLoaders.getFirstLoadTime();
     SUMOTime lastStep = firstStep;
     SUMOTime time = MIN2(firstStep, end);
+    // parse the next definitions while the routing threads compute the current ones
+    const bool parseAhead = myOptions.exists("routing-threads") && myOptions.getInt("routing-threads") > 0;
     while (time <= end) {
         writeStats(time, start, absNo, endGiven);
         myLoaders.loadNext(time);
         if (!net.furtherStored() || MsgHandler::getErrorInstance()->wasInformed()) {
             break;
         }
+        const SUMOTime next = time < end && time + increment > end ? end : time + increment;
+        if (parseAhead) {
+            net.computeRoutesUntil(myOptions, provider, time);
+            if (next <= end) {
+                myLoaders.loadNext(next);
+            }
+        }
         lastStep = net.saveAndRemoveRoutesUntil(myOptions, provider, time);
         if ((!net.furtherStored() && myLoaders.haveAllLoaded()) || MsgHandler::getErrorInstance()->wasInformed()) {
             break;
         }
-        if (time < end && time + increment > end) {
-            time = end;
-        } else {
-            time += increment;
-        }
+        time = next;
     }
     if (myLogSteps) {
         WRITE_MESSAGE("Routes found between time steps " + time2string(firstStep) + " and " + time2string(lastStep) + ".");
@@ -303,6 +308,8 @@ ROLoader::loadWeights(RONet& net, const std::string& optionName,
     for (std::map<std::string, ROEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
         (*i).second->buildTimeLines(measure, boundariesOverride);
     }
+    // routes found so far were computed using the old weights
+    net.getRouteCache().invalidate();
     return true;
 }
 
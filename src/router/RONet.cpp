@@ -45,6 +45,7 @@
 #include "ROPerson.h"
 #include "RORoute.h"
 #include "RORouteDef.h"
+#include "RORouteHandler.h"
 #include "ROVehicle.h"
 #include "RONet.h"
 
@@ -78,7 +79,8 @@ RONet::RONet()
       myHavePermissions(false),
       myNumInternalEdges(0),
       myErrorHandler(OptionsCont::getOptions().exists("ignore-errors")
-                     && OptionsCont::getOptions().getBool("ignore-errors") ? MsgHandler::getWarningInstance() : MsgHandler::getErrorInstance()) {
+                     && OptionsCont::getOptions().getBool("ignore-errors") ? MsgHandler::getWarningInstance() : MsgHandler::getErrorInstance()),
+      myRoutingStarted(false) {
     if (myInstance != 0) {
         throw ProcessError("A network was already constructed.");
     }
@@ -261,9 +263,15 @@ RONet::cleanup() {
     RouteCostCalculator<RORoute, ROEdge, ROVehicle>::cleanup();
 #ifdef HAVE_FOX
     if (myThreadPool.size() > 0) {
+        // routes may still be computed if loading ahead failed
+        myThreadPool.waitAll();
         myThreadPool.clear();
     }
 #endif
+    const std::string cacheStatistics = myRouteCache.getStatistics();
+    if (cacheStatistics != "") {
+        WRITE_MESSAGE("Route cache: " + cacheStatistics + ".");
+    }
 }
 
 
@@ -283,7 +291,7 @@ RONet::getVehicleTypeSecure(const std::string& id) {
     }
     VTypeDistDictType::iterator it2 = myVTypeDistDict.find(id);
     if (it2 != myVTypeDistDict.end()) {
-        return it2->second->get();
+        return it2->second->get(RORouteHandler::getParsingRNG());
     }
     if (id == "") {
         // ok, no vehicle type or an unknown type was given within the user input
@@ -359,9 +367,13 @@ RONet::addVehicle(const std::string& id, ROVehicle* veh) {
 bool
 RONet::addFlow(SUMOVehicleParameter* flow, const bool randomize) {
     if (randomize) {
+        // flows may be added while the routing threads draw random numbers, use the parsing generator then
+        MTRand* const rng = RORouteHandler::getParsingRNG();
+        const SUMOTime range = flow->repetitionNumber * flow->repetitionOffset;
         myDepartures[flow->id].reserve(flow->repetitionNumber);
         for (int i = 0; i < flow->repetitionNumber; ++i) {
-            myDepartures[flow->id].push_back(flow->depart + RandHelper::rand(flow->repetitionNumber * flow->repetitionOffset));
+            const SUMOTime offset = rng == 0 ? RandHelper::rand(range) : (SUMOTime)rng->randInt64((unsigned long long int)(range - 1));
+            myDepartures[flow->id].push_back(flow->depart + offset);
         }
         std::sort(myDepartures[flow->id].begin(), myDepartures[flow->id].end());
         std::reverse(myDepartures[flow->id].begin(), myDepartures[flow->id].end());
@@ -401,7 +413,8 @@ RONet::checkFlows(SUMOTime time, MsgHandler* errorHandler) {
                     break;
                 }
                 // only call rand if all other conditions are met
-                if (RandHelper::rand() < (pars->repetitionProbability * TS)) {
+                MTRand* const rng = RORouteHandler::getParsingRNG();
+                if ((rng == 0 ? RandHelper::rand() : (SUMOReal)rng->randExc()) < (pars->repetitionProbability * TS)) {
                     SUMOVehicleParameter* newPars = new SUMOVehicleParameter(*pars);
                     newPars->id = pars->id + "." + toString(pars->repetitionsDone);
                     newPars->depart = pars->depart;
@@ -520,13 +533,13 @@ RONet::createBulkRouteRequests(const RORouterProvider& provider, const SUMOTime
 }
 
 
-SUMOTime
-RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& provider,
-                                SUMOTime time) {
+void
+RONet::computeRoutesUntil(OptionsCont& options, const RORouterProvider& provider,
+                          SUMOTime time) {
     MsgHandler* mh = (options.getBool("ignore-errors") ?
                       MsgHandler::getWarningInstance() : MsgHandler::getErrorInstance());
     checkFlows(time, mh);
-    SUMOTime lastTime = -1;
+    myRoutingStarted = true;
     const bool removeLoops = options.getBool("remove-loops");
     const int maxNumThreads = options.getInt("routing-threads");
     if (myRoutables.size() != 0) {
@@ -560,10 +573,21 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
                 }
             }
         }
+    }
+}
+
+
+SUMOTime
+RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& provider,
+                                SUMOTime time) {
+    if (!myRoutingStarted) {
+        computeRoutesUntil(options, provider, time);
+    }
+    myRoutingStarted = false;
 #ifdef HAVE_FOX
-        myThreadPool.waitAll();
+    myThreadPool.waitAll();
 #endif
-    }
+    SUMOTime lastTime = -1;
     // write all vehicles (and additional structures)
     while (myRoutables.size() != 0 || myContainers.size() != 0) {
         // get the next vehicle, person or container
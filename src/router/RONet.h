@@ -39,6 +39,7 @@
 #include <utils/common/NamedObjectCont.h>
 #include <utils/common/RandomDistributor.h>
 #include <utils/vehicle/PedestrianRouter.h>
+#include <utils/vehicle/RouteCache.h>
 #include <utils/vehicle/SUMOAbstractRouter.h>
 #include <utils/vehicle/SUMOVehicleParameter.h>
 #include <utils/vehicle/SUMOVTypeParameter.h>
@@ -375,11 +376,26 @@ public:
     /// @name Processing stored vehicle definitions
     //@{
 
+    /** @brief Starts computing the routes of all vehicles and persons departing before the given time
+     *
+     * If routing threads are used, the routes are computed in the background
+     *  while further definitions may be loaded (with departure times not
+     *  before the given time); saveAndRemoveRoutesUntil waits for them.
+     *
+     * @param[in] options The options used during this process
+     * @param[in] provider The router provider for routes computation
+     * @param[in] time The time until which route definitions shall be processed
+     */
+    void computeRoutesUntil(OptionsCont& options,
+                            const RORouterProvider& provider, SUMOTime time);
+
+
     /** @brief Computes routes described by their definitions and saves them
      *
      * As long as a vehicle with a departure time smaller than the given
      *  exists, its route is computed and it is written and removed from
-     *  the internal container.
+     *  the internal container. If the computation was already started
+     *  using computeRoutesUntil, its end is awaited.
      *
      * @param[in] options The options used during this process
      * @param[in] provider The router provider for routes computation
@@ -428,6 +444,11 @@ public:
 
     void setPermissionsFound();
 
+    /// @brief Returns the cache of the routes found (to be invalidated whenever the edge weights change)
+    RouteCache<ROEdge>& getRouteCache() {
+        return myRouteCache;
+    }
+
     OutputDevice* getRouteOutput(const bool alternative = false) {
         if (alternative) {
             return myRouteAlternativesOutput;
@@ -555,6 +576,12 @@ private:
     /// @brief handler for ignorable error messages
     MsgHandler* myErrorHandler;
 
+    /// @brief Whether the computation of routes was started and their saving is still pending
+    bool myRoutingStarted;
+
+    /// @brief The routes found for origin/destination pairs (if --route-cache is set)
+    RouteCache<ROEdge> myRouteCache;
+
 #ifdef HAVE_FOX
 private:
     class RoutingTask : public FXWorkerThread::Task {
@@ -47,6 +47,7 @@
 #include <utils/vehicle/RouteCostCalculator.h>
 #include "RORouteDef.h"
 #include "ROVehicle.h"
+#include "RONet.h"
 
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
@@ -354,7 +355,13 @@ RORouteDef::addAlternative(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
     }
 
     // find the route to use
-    SUMOReal chosen = RandHelper::rand();
+#ifdef HAVE_FOX
+    // with routing threads the vehicle's own stream keeps the choice independent of the order they route in
+    const bool ownStream = RONet::getInstance()->getThreadPool().size() > 0;
+#else
+    const bool ownStream = false;
+#endif
+    SUMOReal chosen = ownStream ? RandHelper::randCounterBased(RandHelper::getStreamID(veh->getID()), 0) : RandHelper::rand();
     int pos = 0;
     for (std::vector<RORoute*>::iterator i = myAlternatives.begin(); i != myAlternatives.end() - 1; i++, pos++) {
         chosen -= (*i)->getProbability();
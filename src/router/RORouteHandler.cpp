@@ -58,9 +58,28 @@
 #endif // CHECK_MEMORY_LEAKS
 
 
+// ===========================================================================
+// static members
+// ===========================================================================
+MTRand RORouteHandler::myParsingRNG;
+bool RORouteHandler::myUseParsingRNG = false;
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
+void
+RORouteHandler::initParsingRNG() {
+    OptionsCont& oc = OptionsCont::getOptions();
+    myUseParsingRNG = oc.exists("routing-threads") && oc.getInt("routing-threads") > 0;
+    if (myUseParsingRNG) {
+        RandHelper::initRandGlobal(&myParsingRNG);
+        // reseed with a number derived from the seed, otherwise the parser would draw the same numbers as the routing
+        myParsingRNG.seed(myParsingRNG.randInt());
+    }
+}
+
+
 RORouteHandler::RORouteHandler(RONet& net, const std::string& file,
                                const bool tryRepair,
                                const bool emptyDestinationsAllowed,
@@ -35,6 +35,7 @@
 #include <string>
 #include <vector>
 #include <utils/common/RandomDistributor.h>
+#include <utils/common/RandHelper.h>
 #include <utils/common/SUMOTime.h>
 #include <utils/vehicle/PedestrianRouter.h>
 #include <utils/xml/SUMORouteHandler.h>
@@ -74,6 +75,18 @@ public:
     /// standard destructor
     virtual ~RORouteHandler();
 
+    /** @brief Initialises the random number generator used while parsing
+     *
+     * The parser only gets an own generator if it parses ahead of the routing threads
+     *  (option routing-threads > 0). Otherwise it keeps using the global one.
+     */
+    static void initParsingRNG();
+
+    /// @brief Returns the random number generator used while parsing (0 for the global one)
+    static MTRand* getParsingRNG() {
+        return myUseParsingRNG ? &myParsingRNG : 0;
+    }
+
 protected:
     /// @name inherited from GenericSAXHandler
     //@{
@@ -187,6 +200,12 @@ protected:
     /// @brief The currently parsed route alternatives
     RORouteDef* myCurrentAlternatives;
 
+    /// @brief A random number generator used to choose from vtype distributions (separated from the one used by the routing threads)
+    static MTRand myParsingRNG;
+
+    /// @brief Whether myParsingRNG is used instead of the global generator
+    static bool myUseParsingRNG;
+
 private:
     /// @brief Invalidated copy constructor
     RORouteHandler(const RORouteHandler& s);
@@ -59,6 +59,7 @@
 #include <utils/common/ToString.h>
 #include <utils/xml/XMLSubSys.h>
 #include <microsim/MSFrame.h>
+#include <microsim/devices/MSDevice_DUA.h>
 #include <microsim/output/MSDetectorControl.h>
 #include <utils/iodevices/OutputDevice.h>
 
@@ -144,7 +145,20 @@ main(int argc, char** argv) {
         // load the net
         net = load(oc);
         if (net != 0) {
-            ret = net->simulate(string2time(oc.getString("begin")), string2time(oc.getString("end")));
+            const SUMOTime begin = string2time(oc.getString("begin"));
+            const int iterations = MAX2(1, oc.getInt("dua.iterations"));
+            for (int iteration = 0; iteration < iterations && ret == 0; ++iteration) {
+                if (iterations > 1) {
+                    WRITE_MESSAGE("Assignment iteration " + toString(iteration) + ".");
+                }
+                if (iteration > 0) {
+                    // reuse the net and the vehicles, outputs go to new files
+                    RandHelper::initRandGlobal();
+                    MSDevice_DUA::nextIteration(*net, begin);
+                }
+                ret = net->simulate(begin, string2time(oc.getString("end")));
+            }
+            net->closeSimulation(begin);
         }
     } catch (const ProcessError& e) {
         if (std::string(e.what()) != std::string("Process Error") && std::string(e.what()) != std::string("")) {
@@ -164,6 +178,7 @@ main(int argc, char** argv) {
         ret = 1;
 #endif
     }
+    MSDevice_DUA::cleanup();
     delete net;
     SystemFrame::close();
     return ret;
@@ -81,6 +81,23 @@ public:
     virtual SUMOTime execute(SUMOTime currentTime) = 0;
 
 
+    /** @brief Reschedules the command when the simulation time is reset
+     *
+     * Called for each pending command if the simulation is reset to an
+     *  earlier time. The default implementation refuses this as the
+     *  command's schedule depends on the time it was built at.
+     *
+     * @param[in] currentTime The current simulation time
+     * @param[in] execTime The time the command is scheduled for
+     * @param[in] newTime The time the simulation continues at
+     * @return The time to execute the command at, a negative value if the command shall be deleted
+     * @exception ProcessError If the command cannot be rescheduled
+     */
+    virtual SUMOTime shiftTime(SUMOTime /* currentTime */, SUMOTime /* execTime */, SUMOTime /* newTime */) {
+        throw ProcessError("The simulation cannot be reset while time-dependent additional structures (e.g. variable speed signs, rerouters, calibrators or vaporizers) are loaded.");
+    }
+
+
 };
 
 
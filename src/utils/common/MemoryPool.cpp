@@ -0,0 +1,121 @@
+/****************************************************************************/
+/// @file    MemoryPool.cpp
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Recycles the memory of frequently created and deleted objects
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <new>
+#include "ToString.h"
+#include "MemoryPool.h"
+
+// debug_new is not included as it redefines new which is called as a function here
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+std::vector<std::vector<void*> > MemoryPool::myFreeBlocks;
+int MemoryPool::myLiveObjects(0);
+int MemoryPool::myMaxLiveObjects(0);
+int MemoryPool::myPooledObjects(0);
+long long int MemoryPool::myPooledBytes(0);
+long long int MemoryPool::myReused(0);
+long long int MemoryPool::myAllocations(0);
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+void*
+MemoryPool::allocate(size_t size) {
+    myAllocations++;
+    myLiveObjects++;
+    if (myLiveObjects > myMaxLiveObjects) {
+        myMaxLiveObjects = myLiveObjects;
+    }
+    if (size > MAX_POOLED_SIZE) {
+        return ::operator new(size);
+    }
+    const size_t sizeClass = size == 0 ? 0 : (size - 1) / GRANULARITY;
+    if (sizeClass < myFreeBlocks.size() && !myFreeBlocks[sizeClass].empty()) {
+        void* const p = myFreeBlocks[sizeClass].back();
+        myFreeBlocks[sizeClass].pop_back();
+        myPooledObjects--;
+        myPooledBytes -= (sizeClass + 1) * GRANULARITY;
+        myReused++;
+        return p;
+    }
+    // all blocks of a size class have the same size, so they can be exchanged
+    return ::operator new((sizeClass + 1) * GRANULARITY);
+}
+
+
+void
+MemoryPool::deallocate(void* p, size_t size) {
+    if (p == 0) {
+        return;
+    }
+    myLiveObjects--;
+    if (size > MAX_POOLED_SIZE) {
+        ::operator delete(p);
+        return;
+    }
+    const size_t sizeClass = size == 0 ? 0 : (size - 1) / GRANULARITY;
+    if (sizeClass >= myFreeBlocks.size()) {
+        myFreeBlocks.resize(sizeClass + 1);
+    }
+    myFreeBlocks[sizeClass].push_back(p);
+    myPooledObjects++;
+    myPooledBytes += (sizeClass + 1) * GRANULARITY;
+}
+
+
+void
+MemoryPool::clear() {
+    for (std::vector<std::vector<void*> >::iterator i = myFreeBlocks.begin(); i != myFreeBlocks.end(); ++i) {
+        for (std::vector<void*>::iterator j = i->begin(); j != i->end(); ++j) {
+            ::operator delete(*j);
+        }
+    }
+    myFreeBlocks.clear();
+    myPooledObjects = 0;
+    myPooledBytes = 0;
+}
+
+
+std::string
+MemoryPool::getStatistics() {
+    if (myAllocations == 0) {
+        return "";
+    }
+    return toString(myLiveObjects) + " objects live (max " + toString(myMaxLiveObjects) + "), "
+           + toString(myPooledObjects) + " freed objects (" + toString(myPooledBytes / 1024) + "kB) kept, "
+           + toString(myReused) + " of " + toString(myAllocations) + " allocations reused memory";
+}
+
+
+/****************************************************************************/
+
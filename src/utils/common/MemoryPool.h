@@ -0,0 +1,131 @@
+/****************************************************************************/
+/// @file    MemoryPool.h
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Recycles the memory of frequently created and deleted objects
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef MemoryPool_h
+#define MemoryPool_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MemoryPool
+ * @brief Keeps the memory of deleted objects for reuse by new objects of similar size
+ *
+ * Classes use the pool by defining their operator new and operator delete
+ *  with allocate and deallocate. The requested sizes are rounded up to
+ *  size classes and freed blocks are kept per size class, so objects which
+ *  are created and deleted all the time (like vehicles and their devices)
+ *  reuse the same memory instead of fragmenting the heap. Objects larger
+ *  than MAX_POOLED_SIZE are passed to the global operators.
+ *
+ * The pool is not thread-safe; all objects using it have to be created and
+ *  deleted by the same thread at a time.
+ */
+class MemoryPool {
+public:
+    /** @brief Returns memory for an object of the given size
+     * @param[in] size The size of the object
+     * @return The memory to construct the object in
+     */
+    static void* allocate(size_t size);
+
+
+    /** @brief Returns the memory of an object to the pool
+     * @param[in] p The memory of the deleted object
+     * @param[in] size The size of the object (as given to allocate)
+     */
+    static void deallocate(void* p, size_t size);
+
+
+    /// @brief Frees the memory kept for reuse
+    static void clear();
+
+
+    /// @brief Returns the number of objects currently allocated from the pool
+    static int getLiveObjects() {
+        return myLiveObjects;
+    }
+
+
+    /// @brief Returns the number of freed blocks kept for reuse
+    static int getPooledObjects() {
+        return myPooledObjects;
+    }
+
+
+    /// @brief Returns the memory kept for reuse in bytes
+    static long long int getPooledBytes() {
+        return myPooledBytes;
+    }
+
+
+    /// @brief Returns a description of the pool's state for the statistics output, "" if unused
+    static std::string getStatistics();
+
+
+    /// @brief The granularity of the size classes
+    static const size_t GRANULARITY = 16;
+
+    /// @brief The size of the largest objects kept for reuse
+    static const size_t MAX_POOLED_SIZE = 4096;
+
+
+private:
+    /// @brief The freed blocks per size class
+    static std::vector<std::vector<void*> > myFreeBlocks;
+
+    /// @brief The number of objects allocated and not yet deallocated
+    static int myLiveObjects;
+
+    /// @brief The maximum number of objects allocated at the same time
+    static int myMaxLiveObjects;
+
+    /// @brief The number of freed blocks kept
+    static int myPooledObjects;
+
+    /// @brief The memory of the freed blocks kept
+    static long long int myPooledBytes;
+
+    /// @brief The number of allocations served by a freed block
+    static long long int myReused;
+
+    /// @brief The number of allocations
+    static long long int myAllocations;
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
@@ -44,6 +44,7 @@
 // static member variables
 // ===========================================================================
 MTRand RandHelper::myRandomNumberGenerator;
+unsigned long long RandHelper::myCounterBasedSeed = 23423;
 
 
 // ===========================================================================
@@ -67,7 +68,8 @@ RandHelper::insertRandOptions() {
 void
 RandHelper::initRandGlobal(MTRand* which) {
     OptionsCont& oc = OptionsCont::getOptions();
-    if (which == 0) {
+    const bool global = which == 0;
+    if (global) {
         which = &myRandomNumberGenerator;
     }
     if (oc.getBool("random")) {
@@ -78,11 +80,52 @@ RandHelper::initRandGlobal(MTRand* which) {
 #else
         which->seed();
 #endif
+        if (global) {
+            myCounterBasedSeed = MTRand::hash(time(NULL), clock());
+        }
     } else {
         which->seed(oc.getInt("seed"));
+        if (global) {
+            myCounterBasedSeed = oc.getInt("seed");
+        }
     }
 }
 
 
+SUMOReal
+RandHelper::randCounterBased(unsigned long long stream, unsigned long long counter) {
+    const unsigned long long mask = 0xffffffffULL;
+    unsigned long long c0 = counter & mask;
+    unsigned long long c1 = (counter >> 32) & mask;
+    unsigned long long c2 = stream & mask;
+    unsigned long long c3 = (stream >> 32) & mask;
+    unsigned long long k0 = myCounterBasedSeed & mask;
+    unsigned long long k1 = (myCounterBasedSeed >> 32) & mask;
+    for (int round = 0; round < 10; ++round) {
+        const unsigned long long p0 = 0xD2511F53ULL * c0;
+        const unsigned long long p1 = 0xCD9E8D57ULL * c2;
+        c0 = ((p1 >> 32) ^ c1 ^ k0) & mask;
+        c1 = p1 & mask;
+        c2 = ((p0 >> 32) ^ c3 ^ k1) & mask;
+        c3 = p0 & mask;
+        k0 = (k0 + 0x9E3779B9ULL) & mask;
+        k1 = (k1 + 0xBB67AE85ULL) & mask;
+    }
+    // use the upper 53 bits of the first two words to fill the mantissa
+    return (SUMOReal)((double)(((c0 << 32) | c1) >> 11) * (1.0 / 9007199254740992.0));
+}
+
+
+unsigned long long
+RandHelper::getStreamID(const std::string& key) {
+    unsigned long long hash = 14695981039346656037ULL;
+    for (std::string::const_iterator i = key.begin(); i != key.end(); ++i) {
+        hash ^= (unsigned char) * i;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+
 /****************************************************************************/
 
@@ -33,6 +33,7 @@
 #endif
 
 #include <cassert>
+#include <string>
 #include <vector>
 #include <foreign/mersenne/MersenneTwister.h>
 
@@ -117,10 +118,36 @@ public:
     }
 
 
+    /// @name Counter-based random number streams
+    /// @{
+
+    /** @brief Returns a random real number in [0, 1) from a counter-based stream
+     *
+     * The number is computed by the Philox4x32-10 bijection of (counter, stream) keyed
+     *  with the seed. It depends on these values only, not on any draws made before,
+     *  so different streams can be evaluated in any order (and concurrently) with
+     *  identical results.
+     * @param[in] stream The id of the stream (i.e. of the simulation object using it)
+     * @param[in] counter The index of the draw within the stream
+     * @return The random number
+     */
+    static SUMOReal randCounterBased(unsigned long long stream, unsigned long long counter);
+
+    /** @brief Returns a stream id for the given key which is stable across runs and platforms
+     * @param[in] key The id of the simulation object using the stream
+     * @return The stream id (FNV-1a hash of the key)
+     */
+    static unsigned long long getStreamID(const std::string& key);
+    /// @}
+
+
 protected:
     /// @brief the random number generator to use
     static MTRand myRandomNumberGenerator;
 
+    /// @brief the key of the counter-based streams
+    static unsigned long long myCounterBasedSeed;
+
 };
 
 #endif
@@ -35,6 +35,7 @@
 #include <cassert>
 #include <limits>
 #include <utils/common/RandHelper.h>
+#include <utils/common/StdDefs.h>
 #include <utils/common/UtilExceptions.h>
 
 
@@ -49,6 +50,11 @@
  *  arbitrary (non-negative) probabilities to its elements. The
  *  random number generator used is specified in RandHelper.
  *
+ * By default a sample is drawn by scanning the members. Large distributions
+ *  may use Walker's alias method instead which draws in constant time from a
+ *  table built by buildAliasTable once the last member was added. Both modes
+ *  consume one random number per draw but map it to different members.
+ *
  * @see RandHelper
  */
 
@@ -56,11 +62,10 @@ template<class T>
 class RandomDistributor {
 public:
     /** @brief Constructor for an empty distribution
-     * @param[in] maximumSize The maximum size to maintain
-     *   older entrys will be removed when adding more than the maximumSize
+     * @param[in] useAliasTable Whether samples shall be drawn using the alias method (@see buildAliasTable)
      */
-    RandomDistributor() :
-        myProb(0) {
+    RandomDistributor(const bool useAliasTable = false) :
+        myProb(0), myUseAliasTable(useAliasTable) {
     }
 
     /// @brief Destructor
@@ -80,6 +85,7 @@ public:
     bool add(SUMOReal prob, T val, bool checkDuplicates = true) {
         assert(prob >= 0);
         myProb += prob;
+        myAliases.clear();
         if (checkDuplicates) {
             for (int i = 0; i < (int)myVals.size(); i++) {
                 if (val == myVals[i]) {
@@ -99,11 +105,21 @@ public:
      *
      * @param[in] which The random number generator to use; the static one will be used if 0 is passed
      * @return the drawn member
+     * @exception ProcessError If the alias method is used but the table does not reflect the members
      */
     T get(MTRand* which = 0) const {
         if (myProb == 0) {
             throw OutOfBoundsException();
         }
+        if (myUseAliasTable) {
+            if (myAliases.size() != myVals.size()) {
+                throw ProcessError("The alias table of the distribution was not built after adding members.");
+            }
+            const int n = (int)myVals.size();
+            const SUMOReal r = which == 0 ? RandHelper::rand((SUMOReal)n) : which->rand((SUMOReal)n);
+            const int i = MIN2((int)r, n - 1);
+            return r - i < myAliasProbs[i] ? myVals[i] : myVals[myAliases[i]];
+        }
         SUMOReal prob = which == 0 ? RandHelper::rand(myProb) : which->rand(myProb);
         for (int i = 0; i < (int)myVals.size(); i++) {
             if (prob < myProbs[i]) {
@@ -127,6 +143,7 @@ public:
     /// @brief Clears the distribution
     void clear() {
         myProb = 0;
+        myAliases.clear();
         myVals.clear();
         myProbs.clear();
     }
@@ -153,6 +170,42 @@ public:
         return myProbs;
     }
 
+    /** @brief Builds the table for drawing with the alias method (Vose's variant of Walker's method)
+     *
+     * Has to be called after the last member was added (if the alias method is used)
+     *  since adding or clearing discards the table.
+     */
+    void buildAliasTable() {
+        const int n = (int)myVals.size();
+        myAliasProbs.assign(n, 1.);
+        myAliases.resize(n);
+        std::vector<SUMOReal> scaled(n);
+        std::vector<int> small;
+        std::vector<int> large;
+        for (int i = 0; i < n; i++) {
+            myAliases[i] = i;
+            scaled[i] = myProbs[i] * n / myProb;
+            if (scaled[i] < 1.) {
+                small.push_back(i);
+            } else {
+                large.push_back(i);
+            }
+        }
+        while (!small.empty() && !large.empty()) {
+            const int s = small.back();
+            small.pop_back();
+            const int l = large.back();
+            myAliasProbs[s] = scaled[s];
+            myAliases[s] = l;
+            scaled[l] += scaled[s] - 1.;
+            if (scaled[l] < 1.) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+        // the remaining entries (only rounding errors left) keep probability 1
+    }
+
 private:
     /// @brief the total probability
     SUMOReal myProb;
@@ -161,6 +214,13 @@ private:
     /// @brief the corresponding probabilities (acts as a ring buffer if myMaximumSize is reached)
     std::vector<SUMOReal> myProbs;
 
+    /// @brief whether samples are drawn using the alias table
+    bool myUseAliasTable;
+    /// @brief the probability to keep the drawn member (per member)
+    std::vector<SUMOReal> myAliasProbs;
+    /// @brief the member to use instead of the drawn one (per member, empty if the table was not built)
+    std::vector<int> myAliases;
+
 };
 
 
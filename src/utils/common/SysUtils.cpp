@@ -32,10 +32,15 @@
 
 #ifndef WIN32
 #include <sys/time.h>
+#include <sys/resource.h>
 #else
 #define NOMINMAX
 #include <windows.h>
+#include <psapi.h>
 #undef NOMINMAX
+#ifdef _MSC_VER
+#pragma comment(lib, "psapi.lib")
+#endif
 #endif
 
 #ifdef CHECK_MEMORY_LEAKS
@@ -63,6 +68,44 @@ SysUtils::getCurrentMillis() {
 }
 
 
+long long int
+SysUtils::getCurrentMicros() {
+#ifndef WIN32
+    timeval current;
+    gettimeofday(&current, 0);
+    return (long long int) current.tv_sec * 1000000LL + (long long int) current.tv_usec;
+#else
+    LARGE_INTEGER val, val2;
+    QueryPerformanceCounter(&val);
+    QueryPerformanceFrequency(&val2);
+    return (long long int)(val.QuadPart / val2.QuadPart * 1000000LL + val.QuadPart % val2.QuadPart * 1000000LL / val2.QuadPart);
+#endif
+}
+
+
+long
+SysUtils::getPeakMemoryKB() {
+#ifndef WIN32
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#ifdef __APPLE__
+    // reported in bytes instead of KB
+    return (long)(usage.ru_maxrss / 1024);
+#else
+    return (long)usage.ru_maxrss;
+#endif
+#else
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return -1;
+    }
+    return (long)(counters.PeakWorkingSetSize / 1024);
+#endif
+}
+
+
 #ifdef _MSC_VER
 long
 SysUtils::getWindowsTicks() {
@@ -46,6 +46,20 @@ public:
     static long getCurrentMillis();
 
 
+    /** @brief Returns the current time in microseconds
+     *
+     * Meant for measuring short durations, the origin is arbitrary.
+     * @return Current time
+     */
+    static long long int getCurrentMicros();
+
+
+    /** @brief Returns the peak memory (resident set size) used by the process so far
+     * @return The peak memory in KB, -1 if it is not known on this platform
+     */
+    static long getPeakMemoryKB();
+
+
 #ifdef _MSC_VER
     /** @brief Returns the CPU ticks (windows only)
      *
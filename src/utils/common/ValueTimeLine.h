@@ -26,7 +26,8 @@
 // ===========================================================================
 // included modules
 // ===========================================================================
-#include <map>
+#include <vector>
+#include <algorithm>
 #include <cassert>
 #include <utility>
 #include <utils/common/SUMOTime.h>
@@ -48,6 +49,11 @@
  * with assigned values. The container is sorted by the first value of the
  * time-range while being filled. Every new inserted time range
  * may overwrite or split one or multiple earlier intervals.
+ *
+ * The interval starts are kept in a contiguous sorted array. Lookups guess
+ * the position assuming equidistant intervals (which is the usual case for
+ * aggregated edge data) and correct the guess by a galloping search, so they
+ * take constant time for regular intervals and logarithmic time otherwise.
  */
 template<typename T>
 class ValueTimeLine {
@@ -70,26 +76,28 @@ public:
         assert(begin >= 0);
         assert(begin < end);
         // inserting strictly before the first or after the last interval (includes empty case)
-        if (myValues.upper_bound(begin) == myValues.end() ||
-                myValues.upper_bound(end) == myValues.begin()) {
-            myValues[begin] = std::make_pair(true, value);
-            myValues[end] = std::make_pair(false, value);
+        if (upperBound(begin) == (int)myValues.size() || upperBound(end) == 0) {
+            set(begin, std::make_pair(true, value));
+            set(end, std::make_pair(false, value));
             return;
         }
         // our end already has a value
-        typename TimedValueMap::iterator endIt = myValues.find(end);
-        if (endIt != myValues.end()) {
-            myValues.erase(myValues.upper_bound(begin), endIt);
-            myValues[begin] = std::make_pair(true, value);
+        const int endIndex = lowerBound(end);
+        if (endIndex < (int)myValues.size() && myValues[endIndex].first == end) {
+            myValues.erase(myValues.begin() + upperBound(begin), myValues.begin() + endIndex);
+            set(begin, std::make_pair(true, value));
             return;
         }
         // we have at least one entry strictly before our end
-        endIt = myValues.lower_bound(end);
-        --endIt;
-        ValidValue oldEndValue = endIt->second;
-        myValues.erase(myValues.upper_bound(begin), myValues.lower_bound(end));
-        myValues[begin] = std::make_pair(true, value);
-        myValues[end] = oldEndValue;
+        ValidValue oldEndValue = myValues[endIndex - 1].second;
+        myValues.erase(myValues.begin() + upperBound(begin), myValues.begin() + endIndex);
+        set(begin, std::make_pair(true, value));
+        set(end, oldEndValue);
+    }
+
+    /// @brief Returns whether no interval was added
+    bool empty() const {
+        return myValues.empty();
     }
 
     /** @brief Returns the value for the given time.
@@ -102,10 +110,9 @@ public:
      */
     T getValue(SUMOReal time) const {
         assert(myValues.size() != 0);
-        typename TimedValueMap::const_iterator it = myValues.upper_bound(time);
-        assert(it != myValues.begin());
-        --it;
-        return it->second.second;
+        const int index = upperBound(time);
+        assert(index != 0);
+        return myValues[index - 1].second.second;
     }
 
     /** @brief Returns whether a value for the given time is known.
@@ -119,12 +126,11 @@ public:
      * @return whether a valid value was set
      */
     bool describesTime(SUMOReal time) const {
-        typename TimedValueMap::const_iterator afterIt = myValues.upper_bound(time);
-        if (afterIt == myValues.begin()) {
+        const int index = upperBound(time);
+        if (index == 0) {
             return false;
         }
-        --afterIt;
-        return afterIt->second.first;
+        return myValues[index - 1].second.first;
     }
 
     /** @brief Returns the time point at which the value changes.
@@ -138,11 +144,9 @@ public:
      * @return the split point
      */
     SUMOReal getSplitTime(SUMOReal low, SUMOReal high) const {
-        typename TimedValueMap::const_iterator afterLow = myValues.upper_bound(low);
-        typename TimedValueMap::const_iterator afterHigh = myValues.upper_bound(high);
-        --afterHigh;
-        if (afterLow == afterHigh) {
-            return afterLow->first;
+        const int afterLow = upperBound(low);
+        if (afterLow < (int)myValues.size() && afterLow == upperBound(high) - 1) {
+            return myValues[afterLow].first;
         }
         return -1;
     }
@@ -153,30 +157,81 @@ public:
      * @param[in] extendOverBoundaries whether the first/last value should be valid for later / earlier times as well
      */
     void fillGaps(T value, bool extendOverBoundaries = false) {
-        for (typename TimedValueMap::iterator it = myValues.begin(); it != myValues.end(); ++it) {
+        for (typename TimedValues::iterator it = myValues.begin(); it != myValues.end(); ++it) {
             if (!it->second.first) {
                 it->second.second = value;
             }
         }
         if (extendOverBoundaries && !myValues.empty()) {
-            typename TimedValueMap::iterator it = --myValues.end();
-            if (!it->second.first) {
-                myValues.erase(it, myValues.end());
+            if (!myValues.back().second.first) {
+                myValues.pop_back();
             }
-            value = myValues.begin()->second.second;
+            value = myValues.front().second.second;
         }
-        myValues[-1] = std::make_pair(false, value);
+        set(-1, std::make_pair(false, value));
     }
 
 private:
     /// @brief Value of time line, indicating validity.
     typedef std::pair<bool, T> ValidValue;
 
-    /// @brief Sorted map from start of intervals to values.
-    typedef std::map<SUMOReal, ValidValue> TimedValueMap;
+    /// @brief Sorted vector of interval starts with values.
+    typedef std::vector<std::pair<SUMOReal, ValidValue> > TimedValues;
+
+    /// @brief Returns the index of the first interval starting after the given time
+    int upperBound(const SUMOReal time) const {
+        const int n = (int)myValues.size();
+        if (n == 0 || time < myValues.front().first) {
+            return 0;
+        }
+        if (time >= myValues.back().first) {
+            return n;
+        }
+        // now n >= 2 and myValues[lo].first <= time < myValues[hi].first holds for lo = 0 and hi = n - 1
+        int guess = (int)((time - myValues.front().first) / (myValues.back().first - myValues.front().first) * (n - 1));
+        guess = std::max(0, std::min(guess, n - 2));
+        int lo = guess;
+        int hi = guess + 1;
+        int step = 1;
+        while (myValues[lo].first > time) {
+            hi = lo;
+            lo = std::max(0, lo - step);
+            step *= 2;
+        }
+        while (myValues[hi].first <= time) {
+            lo = hi;
+            hi = std::min(n - 1, hi + step);
+            step *= 2;
+        }
+        while (hi - lo > 1) {
+            const int mid = lo + (hi - lo) / 2;
+            if (myValues[mid].first <= time) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        return hi;
+    }
+
+    /// @brief Returns the index of the first interval starting at or after the given time
+    int lowerBound(const SUMOReal time) const {
+        const int index = upperBound(time);
+        return index > 0 && myValues[index - 1].first == time ? index - 1 : index;
+    }
+
+    /// @brief Sets the value for the interval starting at the given time (inserting it if needed)
+    void set(const SUMOReal time, const ValidValue& value) {
+        const int index = lowerBound(time);
+        if (index < (int)myValues.size() && myValues[index].first == time) {
+            myValues[index].second = value;
+        } else {
+            myValues.insert(myValues.begin() + index, std::make_pair(time, value));
+        }
+    }
 
     /// @brief The list of time periods (with values)
-    TimedValueMap myValues;
+    TimedValues myValues;
 
 };
 
@@ -110,6 +110,25 @@ public:
         // execute if stil valid
         return (myReceiver->*myOperation)(currentTime);
     }
+
+
+    /** @brief Reschedules the command when the simulation time is reset
+     *
+     * Descheduled commands are deleted, the others cannot be rescheduled.
+     *
+     * @param[in] currentTime The current simulation time
+     * @param[in] execTime The time the command is scheduled for
+     * @param[in] newTime The time the simulation continues at
+     * @return -1 if the command was descheduled
+     * @exception ProcessError If the command is still valid
+     * @see Command::shiftTime
+     */
+    SUMOTime shiftTime(SUMOTime currentTime, SUMOTime execTime, SUMOTime newTime) {
+        if (myAmDescheduledByParent) {
+            return -1;
+        }
+        return Command::shiftTime(currentTime, execTime, newTime);
+    }
     /// @}
 
 
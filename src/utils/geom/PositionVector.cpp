@@ -75,9 +75,21 @@ PositionVector::PositionVector(const Position& p1, const Position& p2) {
 }
 
 
+PositionVector::PositionVector(const PositionVector& v) :
+    AbstractPoly(v), vp(v) {}
+
+
 PositionVector::~PositionVector() {}
 
 
+PositionVector&
+PositionVector::operator=(const PositionVector& v) {
+    vp::operator=(v);
+    clearLengthIndex();
+    return *this;
+}
+
+
 bool
 PositionVector::around(const Position& p, SUMOReal offset) const {
     if (offset != 0) {
@@ -190,6 +202,13 @@ PositionVector::operator[](int index) {
 
 Position
 PositionVector::positionAtOffset(SUMOReal pos, SUMOReal lateralOffset) const {
+    if (hasLengthIndex()) {
+        const int index = segmentAtOffset(myLengths, pos);
+        if (index < 0) {
+            return back();
+        }
+        return positionAtOffset((*this)[index], (*this)[index + 1], pos - myLengths[index], lateralOffset);
+    }
     const_iterator i = begin();
     SUMOReal seenLength = 0;
     do {
@@ -205,6 +224,13 @@ PositionVector::positionAtOffset(SUMOReal pos, SUMOReal lateralOffset) const {
 
 Position
 PositionVector::positionAtOffset2D(SUMOReal pos, SUMOReal lateralOffset) const {
+    if (hasLengthIndex()) {
+        const int index = segmentAtOffset(myLengths2D, pos);
+        if (index < 0) {
+            return back();
+        }
+        return positionAtOffset2D((*this)[index], (*this)[index + 1], pos - myLengths2D[index], lateralOffset);
+    }
     const_iterator i = begin();
     SUMOReal seenLength = 0;
     do {
@@ -223,6 +249,13 @@ PositionVector::rotationAtOffset(SUMOReal pos) const {
     if (pos < 0) {
         pos += length();
     }
+    if (hasLengthIndex()) {
+        const int index = segmentAtOffset(myLengths, pos);
+        if (index >= 0) {
+            return (*this)[index].angleTo2D((*this)[index + 1]);
+        }
+        return (*this)[-2].angleTo2D(back());
+    }
     const_iterator i = begin();
     SUMOReal seenLength = 0;
     do {
@@ -248,6 +281,12 @@ PositionVector::rotationDegreeAtOffset(SUMOReal pos) const {
 
 SUMOReal
 PositionVector::slopeDegreeAtOffset(SUMOReal pos) const {
+    if (hasLengthIndex()) {
+        const int index = segmentAtOffset(myLengths, pos);
+        const Position& p1 = index < 0 ? (*this)[-2] : (*this)[index];
+        const Position& p2 = index < 0 ? back() : (*this)[index + 1];
+        return RAD2DEG(atan2(p2.z() - p1.z(), p1.distanceTo2D(p2)));
+    }
     const_iterator i = begin();
     SUMOReal seenLength = 0;
     do {
@@ -370,6 +409,7 @@ PositionVector::getCentroid() const {
 
 void
 PositionVector::scaleRelative(SUMOReal factor) {
+    clearLengthIndex();
     Position centroid = getCentroid();
     for (int i = 0; i < static_cast<int>(size()); i++) {
         (*this)[i] = centroid + (((*this)[i] - centroid) * factor);
@@ -379,6 +419,7 @@ PositionVector::scaleRelative(SUMOReal factor) {
 
 void
 PositionVector::scaleAbsolute(SUMOReal offset) {
+    clearLengthIndex();
     Position centroid = getCentroid();
     for (int i = 0; i < static_cast<int>(size()); i++) {
         (*this)[i] = centroid + (((*this)[i] - centroid) + offset);
@@ -397,6 +438,9 @@ PositionVector::getLineCenter() const {
 
 SUMOReal
 PositionVector::length() const {
+    if (hasLengthIndex()) {
+        return myLengths.back();
+    }
     SUMOReal len = 0;
     for (const_iterator i = begin(); i != end() - 1; i++) {
         len += (*i).distanceTo(*(i + 1));
@@ -407,6 +451,9 @@ PositionVector::length() const {
 
 SUMOReal
 PositionVector::length2D() const {
+    if (hasLengthIndex()) {
+        return myLengths2D.back();
+    }
     SUMOReal len = 0;
     for (const_iterator i = begin(); i != end() - 1; i++) {
         len += (*i).distanceTo2D(*(i + 1));
@@ -415,6 +462,39 @@ PositionVector::length2D() const {
 }
 
 
+void
+PositionVector::buildLengthIndex() {
+    clearLengthIndex();
+    if (empty()) {
+        return;
+    }
+    myLengths.reserve(size());
+    myLengths2D.reserve(size());
+    SUMOReal len = 0;
+    SUMOReal len2D = 0;
+    myLengths.push_back(len);
+    myLengths2D.push_back(len2D);
+    for (const_iterator i = begin(); i != end() - 1; i++) {
+        // summed up in the same order as by length() to get identical values
+        len += (*i).distanceTo(*(i + 1));
+        len2D += (*i).distanceTo2D(*(i + 1));
+        myLengths.push_back(len);
+        myLengths2D.push_back(len2D);
+    }
+}
+
+
+int
+PositionVector::segmentAtOffset(const std::vector<SUMOReal>& lengths, SUMOReal pos) {
+    // the first segment whose end lies behind pos (as found when walking along the segments)
+    const std::vector<SUMOReal>::const_iterator segEnd = std::upper_bound(lengths.begin() + 1, lengths.end(), pos);
+    if (segEnd == lengths.end()) {
+        return -1;
+    }
+    return (int)(segEnd - lengths.begin()) - 1;
+}
+
+
 SUMOReal
 PositionVector::area() const {
     if (size() < 3) {
@@ -509,12 +589,14 @@ operator<<(std::ostream& os, const PositionVector& geom) {
 
 void
 PositionVector::sortAsPolyCWByAngle() {
+    clearLengthIndex();
     std::sort(begin(), end(), as_poly_cw_sorter());
 }
 
 
 void
 PositionVector::add(SUMOReal xoff, SUMOReal yoff, SUMOReal zoff) {
+    clearLengthIndex();
     for (int i = 0; i < static_cast<int>(size()); i++) {
         (*this)[i].add(xoff, yoff, zoff);
     }
@@ -529,6 +611,7 @@ PositionVector::add(const Position& offset) {
 
 void
 PositionVector::mirrorX() {
+    clearLengthIndex();
     for (int i = 0; i < static_cast<int>(size()); i++) {
         (*this)[i].mul(1, -1);
     }
@@ -546,6 +629,7 @@ PositionVector::as_poly_cw_sorter::operator()(const Position& p1, const Position
 
 void
 PositionVector::sortByIncreasingXY() {
+    clearLengthIndex();
     std::sort(begin(), end(), increasing_x_y_sorter());
 }
 
@@ -579,6 +663,7 @@ PositionVector::convexHull() const {
 
 void
 PositionVector::append(const PositionVector& v, SUMOReal sameThreshold) {
+    clearLengthIndex();
     if (size() > 0 && v.size() > 0 && back().distanceTo(v[0]) < sameThreshold) {
         copy(v.begin() + 1, v.end(), back_inserter(*this));
     } else {
@@ -688,6 +773,7 @@ PositionVector::nearest_offset_to_point2D(const Position& p, bool perpendicular)
     SUMOReal minDist = std::numeric_limits<SUMOReal>::max();
     SUMOReal nearestPos = GeomHelper::INVALID_OFFSET;
     SUMOReal seen = 0;
+    const bool indexed = hasLengthIndex();
     for (const_iterator i = begin(); i != end() - 1; i++) {
         const SUMOReal pos =
             GeomHelper::nearest_offset_on_line_to_point2D(*i, *(i + 1), p, perpendicular);
@@ -710,7 +796,7 @@ PositionVector::nearest_offset_to_point2D(const Position& p, bool perpendicular)
                 }
             }
         }
-        seen += (*i).distanceTo2D(*(i + 1));
+        seen = indexed ? myLengths2D[i + 1 - begin()] : seen + (*i).distanceTo2D(*(i + 1));
     }
     return nearestPos;
 }
@@ -782,6 +868,7 @@ PositionVector::indexOfClosest(const Position& p) const {
 
 int
 PositionVector::insertAtClosest(const Position& p) {
+    clearLengthIndex();
     SUMOReal minDist = std::numeric_limits<SUMOReal>::max();
     int insertionIndex = 1;
     for (int i = 0; i < (int)size() - 1; i++) {
@@ -800,6 +887,7 @@ PositionVector::insertAtClosest(const Position& p) {
 
 int
 PositionVector::removeClosest(const Position& p) {
+    clearLengthIndex();
     if (size() == 0) {
         return -1;
     }
@@ -847,6 +935,7 @@ PositionVector::intersectsAtLengths2D(const Position& lp1, const Position& lp2)
 
 void
 PositionVector::extrapolate(const SUMOReal val, const bool onlyFirst) {
+    clearLengthIndex();
     assert(size() > 1);
     Position& p1 = (*this)[0];
     Position& p2 = (*this)[1];
@@ -866,6 +955,7 @@ PositionVector::extrapolate(const SUMOReal val, const bool onlyFirst) {
 
 void
 PositionVector::extrapolate2D(const SUMOReal val, const bool onlyFirst) {
+    clearLengthIndex();
     assert(size() > 1);
     Position& p1 = (*this)[0];
     Position& p2 = (*this)[1];
@@ -960,6 +1050,7 @@ PositionVector::angleAt2D(int pos) const {
 
 void
 PositionVector::closePolygon() {
+    clearLengthIndex();
     if (size() == 0 || (*this)[0] == back()) {
         return;
     }
@@ -1005,6 +1096,7 @@ PositionVector::distance2D(const Position& p, bool perpendicular) const {
 
 void
 PositionVector::push_back_noDoublePos(const Position& p) {
+    clearLengthIndex();
     if (size() == 0 || !p.almostSame(back())) {
         push_back(p);
     }
@@ -1013,6 +1105,7 @@ PositionVector::push_back_noDoublePos(const Position& p) {
 
 void
 PositionVector::push_front_noDoublePos(const Position& p) {
+    clearLengthIndex();
     if (size() == 0 || !p.almostSame(front())) {
         insert(begin(), p);
     }
@@ -1027,6 +1120,7 @@ PositionVector::isClosed() const {
 
 void
 PositionVector::removeDoublePoints(SUMOReal minDist, bool assertLength) {
+    clearLengthIndex();
     if (size() > 1) {
         iterator last = begin();
         for (iterator i = begin() + 1; i != end() && (!assertLength || size() > 2);) {
@@ -1156,6 +1250,7 @@ PositionVector::intersects(const Position& p11, const Position& p12, const Posit
 
 void
 PositionVector::rotate2D(SUMOReal angle) {
+    clearLengthIndex();
     const SUMOReal s = sin(angle);
     const SUMOReal c = cos(angle);
     for (int i = 0; i < (int)size(); i++) {
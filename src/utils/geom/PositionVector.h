@@ -73,9 +73,16 @@ public:
     /// @param[in] p2 the second position
     PositionVector(const Position& p1, const Position& p2);
 
+    /// @brief Copy Constructor (the length index is not copied)
+    /// @param[in] v The positionVector to copy
+    PositionVector(const PositionVector& v);
+
     /// @brief Destructor
     ~PositionVector();
 
+    /// @brief Assignment operator (the length index is not copied)
+    PositionVector& operator=(const PositionVector& v);
+
     /// @name methode for iterate over PositionVector
     /// @{
     /// @brief iterator
@@ -206,6 +213,16 @@ public:
     /// @brief Returns the length
     SUMOReal length2D() const;
 
+    /** @brief Stores the cumulative lengths up to each position for faster lookups
+     *
+     * The methods working on offsets (positionAtOffset, rotationAtOffset,
+     *  slopeDegreeAtOffset, length and their 2D variants) then find the segment
+     *  by a binary search instead of summing up the segment lengths. The index
+     *  is not copied. It is dropped by the methods changing the positions but
+     *  has to be rebuilt after changing positions using iterators or operator[].
+     */
+    void buildLengthIndex();
+
     /// @brief Returns the area (0 for non-closed)
     SUMOReal area() const;
 
@@ -362,6 +379,27 @@ public:
 private:
     /// @brief return whether the line segments defined by Line p11,p12 and Line p21,p22 intersect
     static bool intersects(const Position& p11, const Position& p12, const Position& p21, const Position& p22, const SUMOReal withinDist = 0., SUMOReal* x = 0, SUMOReal* y = 0, SUMOReal* mu = 0);
+
+    /// @brief return whether the length index matches the positions
+    bool hasLengthIndex() const {
+        return !myLengths.empty() && myLengths.size() == size();
+    }
+
+    /// @brief return the index of the segment containing the offset according to the given cumulative lengths, -1 if beyond the end
+    static int segmentAtOffset(const std::vector<SUMOReal>& lengths, SUMOReal pos);
+
+    /// @brief drops the length index (to be called when changing positions)
+    void clearLengthIndex() {
+        myLengths.clear();
+        myLengths2D.clear();
+    }
+
+private:
+    /// @brief The cumulative lengths up to each position (empty if not built)
+    std::vector<SUMOReal> myLengths;
+
+    /// @brief The cumulative 2D lengths up to each position (empty if not built)
+    std::vector<SUMOReal> myLengths2D;
 };
 
 
@@ -48,7 +48,7 @@ bool GUIVisualizationSettings::UseMesoSim = false;
 // member method definitions
 // ===========================================================================
 GUIVisualizationSettings::GUIVisualizationSettings()
-    : name(""), antialiase(false), dither(false),
+    : name(""), antialiase(false), dither(false), fps(false),
       backgroundColor(RGBColor::WHITE),
       showGrid(false), gridXSize(100), gridYSize(100),
       laneShowBorders(false), showLinkDecals(true),
@@ -663,6 +663,7 @@ GUIVisualizationSettings::save(OutputDevice& dev) const {
     dev.openTag(SUMO_TAG_VIEWSETTINGS_OPENGL);
     dev.writeAttr("antialiase", antialiase);
     dev.writeAttr("dither", dither);
+    dev.writeAttr("fps", fps);
     dev.closeTag();
     dev.openTag(SUMO_TAG_VIEWSETTINGS_BACKGROUND);
     dev.writeAttr("backgroundColor", backgroundColor);
@@ -789,6 +790,9 @@ GUIVisualizationSettings::operator==(const GUIVisualizationSettings& v2) {
     if (dither != v2.dither) {
         return false;
     }
+    if (fps != v2.fps) {
+        return false;
+    }
     if (backgroundColor != v2.backgroundColor) {
         return false;
     }
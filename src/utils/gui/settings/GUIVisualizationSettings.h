@@ -127,6 +127,8 @@ public:
     bool antialiase;
     /// @brief Information whether dithering shall be enabled
     bool dither;
+    /// @brief Information whether frames per second and the frame drawing time shall be shown
+    bool fps;
 
     /// @name Background visualization settings
     //@{
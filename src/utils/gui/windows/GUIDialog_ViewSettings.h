@@ -314,6 +314,7 @@ private:
     FXCheckButton* myDrawCrossingsAndWalkingAreas;
     FXCheckButton* myAntialiase;
     FXCheckButton* myDither;
+    FXCheckButton* myShowFPS;
     FXCheckButton* myShowSizeLegend;
 
     NamePanel* myEdgeNamePanel, *myInternalEdgeNamePanel, *myCwaEdgeNamePanel, *myStreetNamePanel,
@@ -47,6 +47,7 @@
 #include <utils/common/ToString.h>
 #include <utils/common/StringUtils.h>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/SysUtils.h>
 #include <utils/gui/windows/GUIAppEnum.h>
 #include <utils/gui/globjects/GUIGLObjectPopupMenu.h>
 #include <utils/gui/images/GUITexturesHelper.h>
@@ -77,6 +78,12 @@
 #endif // CHECK_MEMORY_LEAKS
 
 
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+int GUISUMOAbstractView::myDisplayListGeneration = 0;
+
+
 // ===========================================================================
 // member method definitions
 // ===========================================================================
@@ -123,7 +130,13 @@ GUISUMOAbstractView::GUISUMOAbstractView(FXComposite* p, GUIMainWindow& app, GUI
     myViewportChooser(0),
     myWindowCursorPositionX(getWidth() / 2),
     myWindowCursorPositionY(getHeight() / 2),
-    myVisualizationChanger(0) {
+    myVisualizationChanger(0),
+    myFrameDrawTime(0),
+    myBenchmarkFrames(0) {
+    if (share == 0) {
+        // the display lists of closed views are gone
+        myDisplayListGeneration++;
+    }
     setTarget(this);
     enable();
     flags |= FLAG_ENABLED;
@@ -270,11 +283,18 @@ GUISUMOAbstractView::paintGL() {
         glDisable(GL_LINE_SMOOTH);
     }
 
+    const long start = SysUtils::getCurrentMillis();
     applyGLTransform();
     doPaintGL(GL_RENDER, myChanger->getViewport());
     if (myVisualizationSettings->showSizeLegend) {
         displayLegend();
     }
+    if (myVisualizationSettings->fps) {
+        // wait for the pipeline so that the measured time covers the rendering, too
+        glFinish();
+        myFrameDrawTime = SysUtils::getCurrentMillis() - start;
+        drawFPS();
+    }
     // check whether the select mode /tooltips)
     //  shall be computed, too
     if (myUseToolTips && id != GUIGlObject::INVALID_ID) {
@@ -516,6 +536,56 @@ GUISUMOAbstractView::displayLegend() {
 }
 
 
+void
+GUISUMOAbstractView::drawFPS() {
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_ALPHA_TEST);
+    glDisable(GL_BLEND);
+    glEnable(GL_DEPTH_TEST);
+    glColor3d(1, 0, 0);
+    const std::string text = "FPS " + toString((SUMOReal)1000. / MAX2((long)1, myFrameDrawTime), 1) + " (" + toString(myFrameDrawTime) + "ms)";
+    SUMOReal w = SUMOReal(35) / SUMOReal(getWidth());
+    SUMOReal h = SUMOReal(35) / SUMOReal(getHeight());
+    pfSetPosition(SUMOReal(0.75), SUMOReal(-0.95));
+    pfSetScaleXY(w, h);
+    glRotated(180, 1, 0, 0);
+    pfDrawString(text.c_str());
+    glRotated(-180, 1, 0, 0);
+    // restore matrices
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+}
+
+
+void
+GUISUMOAbstractView::runBenchmark() {
+    const int frames = myBenchmarkFrames;
+    myBenchmarkFrames = 0;
+    long total = 0;
+    long fastest = std::numeric_limits<long>::max();
+    for (int i = 0; i < frames; ++i) {
+        const long start = SysUtils::getCurrentMillis();
+        paintGL();
+        // wait for the pipeline so that the measured time covers the rendering, too
+        glFinish();
+        const long duration = SysUtils::getCurrentMillis() - start;
+        total += duration;
+        fastest = MIN2(fastest, duration);
+    }
+    WRITE_MESSAGE("Drew " + toString(frames) + " frames of " + toString(getWidth()) + "x" + toString(getHeight())
+                  + " pixels in " + toString(total) + "ms (" + toString((SUMOReal)total / (SUMOReal)frames, 2)
+                  + "ms per frame on average, fastest frame " + toString(fastest) + "ms).");
+}
+
+
 SUMOReal
 GUISUMOAbstractView::m2p(SUMOReal meter) const {
     return  meter * getWidth() / myChanger->getViewport().getWidth();
@@ -603,6 +673,9 @@ GUISUMOAbstractView::onPaint(FXObject*, FXSelector, void*) {
         return 1;
     }
     if (makeCurrent()) {
+        if (myBenchmarkFrames > 0) {
+            runBenchmark();
+        }
         paintGL();
         makeNonCurrent();
     }
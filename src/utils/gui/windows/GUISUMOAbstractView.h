@@ -326,6 +326,24 @@ public:
     /// @brief Sets the delay of the parent application
     void setDelay(SUMOReal delay);
 
+    /** @brief Returns the number of display list namespaces created so far
+     *
+     * All views share the display lists of the first open view. A view opened
+     *  when no other view exists gets a new (empty) namespace, so display lists
+     *  recorded for an older value are gone and have to be rebuilt.
+     */
+    static int getDisplayListGeneration() {
+        return myDisplayListGeneration;
+    }
+
+    /** @brief Draws the current viewport the given number of times at the next repaint and reports the drawing times
+     * @param[in] frames The number of frames to draw
+     */
+    void benchmark(int frames) {
+        myBenchmarkFrames = frames;
+        update();
+    }
+
 protected:
     ///@brief performs the painting of the simulation
     void paintGL();
@@ -345,6 +363,12 @@ protected:
     ///@briefDraws a line with ticks, and the length information.
     void displayLegend();
 
+    ///@brief Draws frames per second and the time needed for drawing the last frame
+    void drawFPS();
+
+    ///@brief Draws the frames requested by benchmark and reports the times needed (the GL context must be current)
+    void runBenchmark();
+
     ///@brief returns the id of the object under the cursor using GL_SELECT
     GUIGlID getObjectUnderCursor();
 
@@ -430,6 +454,15 @@ protected:
     ///@brief List of objects for which GUIGlObject::drawGLAdditional is called
     std::map<const GUIGlObject*, int> myAdditionallyDrawn;
 
+    ///@brief The time needed for drawing the last frame in milliseconds (only measured if fps are shown)
+    long myFrameDrawTime;
+
+    ///@brief The number of frames to draw at the next repaint for measuring the drawing performance
+    int myBenchmarkFrames;
+
+    ///@brief The number of display list namespaces created so far
+    static int myDisplayListGeneration;
+
 protected:
     ///@brief empty constructor
     GUISUMOAbstractView() { }
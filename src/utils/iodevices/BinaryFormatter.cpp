@@ -34,6 +34,7 @@
 #include <version.h>
 #endif
 
+#include <cstdlib>
 #include <utils/common/RGBColor.h>
 #include <utils/common/ToString.h>
 #include <utils/common/FileHelpers.h>
@@ -81,7 +82,7 @@ BinaryFormatter::writeStringList(std::ostream& into, const std::vector<std::stri
 bool
 BinaryFormatter::writeXMLHeader(std::ostream& into,
                                 const std::string& rootElement,
-                                const std::string& /* attrs */,
+                                const std::string& attrs,
                                 const std::string& /* comment */) {
     if (myXMLStack.empty()) {
         FileHelpers::writeByte(into, BF_BYTE);
@@ -97,6 +98,36 @@ BinaryFormatter::writeXMLHeader(std::ostream& into,
 
         if (SUMOXMLDefinitions::Tags.hasString(rootElement)) {
             openTag(into, rootElement);
+            // keep the known attributes of the root element (e.g. the network version)
+            std::string::size_type pos = attrs.find('=');
+            while (pos != std::string::npos && pos + 1 < attrs.size() && attrs[pos + 1] == '"') {
+                const std::string::size_type nameStart = attrs.find_last_of(' ', pos);
+                const std::string name = attrs.substr(nameStart == std::string::npos ? 0 : nameStart + 1, pos - (nameStart == std::string::npos ? 0 : nameStart + 1));
+                const std::string::size_type valueEnd = attrs.find('"', pos + 2);
+                if (valueEnd == std::string::npos) {
+                    break;
+                }
+                const std::string value = attrs.substr(pos + 2, valueEnd - pos - 2);
+                if (SUMOXMLDefinitions::Attrs.hasString(name)) {
+                    const SumoXMLAttr attr = (SumoXMLAttr)SUMOXMLDefinitions::Attrs.get(name);
+                    // numbers get their type so they can be read back as such (the version stays a string)
+                    char* end = 0;
+                    const long intValue = value.empty() ? 0 : strtol(value.c_str(), &end, 10);
+                    if (value == "true" || value == "false") {
+                        writeAttr(into, attr, value == "true");
+                    } else if (attr != SUMO_ATTR_VERSION && end != 0 && *end == '\0') {
+                        writeAttr(into, attr, (int)intValue);
+                    } else {
+                        const SUMOReal floatValue = value.empty() ? 0 : (SUMOReal)strtod(value.c_str(), &end);
+                        if (attr != SUMO_ATTR_VERSION && !value.empty() && *end == '\0') {
+                            writeAttr(into, attr, floatValue);
+                        } else {
+                            writeAttr(into, attr, value);
+                        }
+                    }
+                }
+                pos = attrs.find('=', valueEnd);
+            }
             return true;
         }
     }
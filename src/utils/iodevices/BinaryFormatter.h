@@ -121,8 +121,11 @@ public:
      * @param[in] into The output stream to use
      * @param[in] rootElement The root element to use
      * @param[in] attrs Additional attributes to save within the rootElement
-     * @param[in] comment Additional comment (saved in front the rootElement)
-     * @todo Check which parameter is used herein
+     * @param[in] comment Additional comment (not saved in binary files)
+     *
+     * Of the additional attributes, given as XML text, only those known to
+     *  SUMOXMLDefinitions are saved, "true" and "false" as bools and all
+     *  others as strings.
      * @todo Describe what is saved
      */
     bool writeXMLHeader(std::ostream& into, const std::string& rootElement,
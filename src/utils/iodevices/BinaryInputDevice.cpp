@@ -29,56 +29,193 @@
 #include <config.h>
 #endif
 
+#include <algorithm>
 #include <string>
+#include <cstring>
+#include <fstream>
 #include <utils/common/StdDefs.h>
+#include <utils/common/ToString.h>
+#include <utils/common/UtilExceptions.h>
 #include <utils/geom/Position.h>
 #include "BinaryFormatter.h"
 #include "BinaryInputDevice.h"
 
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define NOMINMAX
+#include <windows.h>
+#undef NOMINMAX
+#endif
+
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
 #endif // CHECK_MEMORY_LEAKS
 
-// ===========================================================================
-// constants definitions
-// ===========================================================================
-#define BUF_MAX 10000
-
 
 // ===========================================================================
 // method definitions
 // ===========================================================================
 BinaryInputDevice::BinaryInputDevice(const std::string& name,
                                      const bool isTyped, const bool doValidate)
-    : myStream(name.c_str(), std::fstream::in | std::fstream::binary),
-      myAmTyped(isTyped), myEnableValidation(doValidate) {}
+    : myName(name), myAmTyped(isTyped), myEnableValidation(doValidate),
+      myData(0), myPos(0), myEnd(0), myAmGood(false), myHasPutback(false), myPutback(0), myMapping(0) {
+    // long is 32 bit on Windows
+    long long size = -1;
+#ifndef WIN32
+    const int fd = open(name.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat info;
+        if (fstat(fd, &info) == 0) {
+            size = (long long)info.st_size;
+            if (size > 0) {
+                void* const mapped = mmap(0, (size_t)size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapped != MAP_FAILED) {
+                    myMapping = mapped;
+#ifdef MADV_SEQUENTIAL
+                    madvise(mapped, (size_t)size, MADV_SEQUENTIAL);
+#endif
+                }
+            }
+        }
+        close(fd);
+    }
+#else
+    myFileHandle = 0;
+    myMappingHandle = 0;
+    HANDLE file = CreateFileA(name.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize)) {
+            size = (long long)fileSize.QuadPart;
+            if (size > 0) {
+                HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+                if (mapping != NULL) {
+                    myMapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    if (myMapping == 0) {
+                        CloseHandle(mapping);
+                    } else {
+                        myMappingHandle = mapping;
+                    }
+                }
+            }
+        }
+        if (myMapping == 0) {
+            CloseHandle(file);
+        } else {
+            myFileHandle = file;
+        }
+    }
+#endif
+    if (myMapping != 0) {
+        myData = static_cast<const char*>(myMapping);
+    } else if (size >= 0) {
+        // mapping is not possible (or the file is empty), read the contents instead
+        std::ifstream strm(name.c_str(), std::fstream::in | std::fstream::binary);
+        if (strm.good()) {
+            myBuffer.resize((size_t)size);
+            if (size > 0) {
+                strm.read(&myBuffer[0], (std::streamsize)size);
+                size = (long long)strm.gcount();
+            }
+        } else {
+            size = -1;
+        }
+        myData = size > 0 ? &myBuffer[0] : 0;
+    }
+    if (size >= 0) {
+        myPos = myData;
+        myEnd = myData + size;
+        myAmGood = true;
+    }
+}
+
+
+BinaryInputDevice::~BinaryInputDevice() {
+    unmap();
+}
 
 
-BinaryInputDevice::~BinaryInputDevice() {}
+void
+BinaryInputDevice::unmap() {
+    if (myMapping != 0) {
+#ifndef WIN32
+        munmap(myMapping, (size_t)(myEnd - myData));
+#else
+        UnmapViewOfFile(myMapping);
+        CloseHandle(myMappingHandle);
+        CloseHandle(myFileHandle);
+#endif
+        myMapping = 0;
+    }
+}
 
 
 bool
 BinaryInputDevice::good() const {
-    return myStream.good();
+    return myAmGood;
 }
 
 
 int
 BinaryInputDevice::peek() {
-    return myStream.peek();
+    if (myHasPutback) {
+        return (unsigned char)myPutback;
+    }
+    if (myPos == myEnd) {
+        return EOF;
+    }
+    return (unsigned char)*myPos;
 }
 
 
 std::string
 BinaryInputDevice::read(int numBytes) {
-    myStream.read((char*) &myBuffer, sizeof(char)*numBytes);
-    return std::string(myBuffer, numBytes);
+    std::string result;
+    if (numBytes > 0 && myHasPutback) {
+        result += myPutback;
+        myHasPutback = false;
+        numBytes--;
+    }
+    const char* const start = myPos;
+    readBytes(0, numBytes);
+    return result.append(start, numBytes);
 }
 
 
 void
 BinaryInputDevice::putback(char c) {
-    myStream.putback(c);
+    myPutback = c;
+    myHasPutback = true;
+}
+
+
+void
+BinaryInputDevice::readBytes(void* into, int numBytes) {
+    if (numBytes > 0 && myHasPutback) {
+        char* const target = static_cast<char*>(into);
+        if (target != 0) {
+            *target = myPutback;
+            into = target + 1;
+        }
+        myHasPutback = false;
+        numBytes--;
+    }
+    if (numBytes < 0) {
+        myAmGood = false;
+        throw ProcessError("Invalid number of bytes to read from binary file '" + myName + "'.");
+    }
+    if (!myAmGood || myEnd - myPos < numBytes) {
+        myAmGood = false;
+        throw ProcessError("Unexpected end of binary file '" + myName + "'.");
+    }
+    if (into != 0) {
+        memcpy(into, myPos, numBytes);
+    }
+    myPos += numBytes;
 }
 
 
@@ -86,7 +223,7 @@ int
 BinaryInputDevice::checkType(BinaryFormatter::DataType t) {
     if (myAmTyped) {
         char c;
-        myStream.read(&c, sizeof(char));
+        readBytes(&c, sizeof(char));
         if (myEnableValidation && c != t) {
             throw ProcessError("Unexpected type.");
         }
@@ -99,7 +236,7 @@ BinaryInputDevice::checkType(BinaryFormatter::DataType t) {
 BinaryInputDevice&
 operator>>(BinaryInputDevice& os, char& c) {
     os.checkType(BinaryFormatter::BF_BYTE);
-    os.myStream.read(&c, sizeof(char));
+    os.readBytes(&c, sizeof(char));
     return os;
 }
 
@@ -107,7 +244,7 @@ operator>>(BinaryInputDevice& os, char& c) {
 BinaryInputDevice&
 operator>>(BinaryInputDevice& os, unsigned char& c) {
     os.checkType(BinaryFormatter::BF_BYTE);
-    os.myStream.read((char*) &c, sizeof(unsigned char));
+    os.readBytes(&c, sizeof(unsigned char));
     return os;
 }
 
@@ -115,7 +252,7 @@ operator>>(BinaryInputDevice& os, unsigned char& c) {
 BinaryInputDevice&
 operator>>(BinaryInputDevice& os, int& i) {
     os.checkType(BinaryFormatter::BF_INTEGER);
-    os.myStream.read((char*) &i, sizeof(int));
+    os.readBytes(&i, sizeof(int));
     return os;
 }
 
@@ -125,10 +262,10 @@ operator>>(BinaryInputDevice& os, SUMOReal& f) {
     int t = os.checkType(BinaryFormatter::BF_FLOAT);
     if (t == BinaryFormatter::BF_SCALED2INT) {
         int v;
-        os.myStream.read((char*) &v, sizeof(int));
+        os.readBytes(&v, sizeof(int));
         f = v / 100.;
     } else {
-        os.myStream.read((char*) &f, sizeof(SUMOReal));
+        os.readBytes(&f, sizeof(SUMOReal));
     }
     return os;
 }
@@ -137,8 +274,9 @@ operator>>(BinaryInputDevice& os, SUMOReal& f) {
 BinaryInputDevice&
 operator>>(BinaryInputDevice& os, bool& b) {
     os.checkType(BinaryFormatter::BF_BYTE);
-    b = false;
-    os.myStream.read((char*) &b, sizeof(char));
+    char c;
+    os.readBytes(&c, sizeof(char));
+    b = c != 0;
     return os;
 }
 
@@ -147,15 +285,15 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::string& s) {
     os.checkType(BinaryFormatter::BF_STRING);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
-    int done = 0;
-    while (done < size) {
-        const int toRead = MIN2((int)size - done, (int)BUF_MAX - 1);
-        os.myStream.read((char*) &os.myBuffer, sizeof(char)*toRead);
-        os.myBuffer[toRead] = 0;
-        s += std::string(os.myBuffer);
-        done += toRead;
+    os.readBytes(&size, sizeof(int));
+    if (size < 0) {
+        os.myAmGood = false;
+        throw ProcessError("Invalid string length " + toString(size) + " in binary file '" + os.myName + "'.");
     }
+    const char* const start = os.myPos;
+    os.readBytes(0, size);
+    // strings are used as they are, without a copy into an intermediate buffer
+    s.append(start, std::find(start, start + size, '\0'));
     return os;
 }
 
@@ -164,7 +302,8 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::vector<std::string>& v) {
     os.checkType(BinaryFormatter::BF_LIST);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
+    os.readBytes(&size, sizeof(int));
+    v.reserve(v.size() + MAX2(size, 0));
     while (size > 0) {
         std::string s;
         os >> s;
@@ -179,7 +318,8 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::vector<int>& v) {
     os.checkType(BinaryFormatter::BF_LIST);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
+    os.readBytes(&size, sizeof(int));
+    v.reserve(v.size() + MAX2(size, 0));
     while (size > 0) {
         int i;
         os >> i;
@@ -194,7 +334,8 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::vector< std::vector<int> >& v) {
     os.checkType(BinaryFormatter::BF_LIST);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
+    os.readBytes(&size, sizeof(int));
+    v.reserve(v.size() + MAX2(size, 0));
     while (size > 0) {
         std::vector<int> nested;
         os >> nested;
@@ -209,21 +350,21 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, Position& p) {
     int t = os.checkType(BinaryFormatter::BF_POSITION_2D);
     SUMOReal x, y, z = 0;
-    if (t == BinaryFormatter::BF_SCALED2INT_POSITION_2D || t == BinaryFormatter::BF_SCALED2INT_POSITION_2D) {
+    if (t == BinaryFormatter::BF_SCALED2INT_POSITION_2D || t == BinaryFormatter::BF_SCALED2INT_POSITION_3D) {
         int v;
-        os.myStream.read((char*) &v, sizeof(int));
+        os.readBytes(&v, sizeof(int));
         x = v / 100.;
-        os.myStream.read((char*) &v, sizeof(int));
+        os.readBytes(&v, sizeof(int));
         y = v / 100.;
         if (t == BinaryFormatter::BF_SCALED2INT_POSITION_3D) {
-            os.myStream.read((char*) &v, sizeof(int));
+            os.readBytes(&v, sizeof(int));
             z = v / 100.;
         }
     } else {
-        os.myStream.read((char*) &x, sizeof(SUMOReal));
-        os.myStream.read((char*) &y, sizeof(SUMOReal));
+        os.readBytes(&x, sizeof(SUMOReal));
+        os.readBytes(&y, sizeof(SUMOReal));
         if (t == BinaryFormatter::BF_POSITION_3D) {
-            os.myStream.read((char*) &z, sizeof(SUMOReal));
+            os.readBytes(&z, sizeof(SUMOReal));
         }
     }
     p.set(x, y, z);
@@ -34,7 +34,6 @@
 
 #include <string>
 #include <vector>
-#include <fstream>
 #include "BinaryFormatter.h"
 
 
@@ -51,8 +50,10 @@ class BinaryInputDevice;
  * @class BinaryInputDevice
  * @brief Encapsulates binary reading operations on a file
  *
- * This class opens a binary file stream for reading and offers read access
- *  functions on it.
+ * This class opens a binary file for reading and offers read access
+ *  functions on it. The file is memory mapped where possible (and read into
+ *  memory completely otherwise), so reading a value is a plain copy out of
+ *  memory. This makes loading binary (.sbx) networks and states cheap.
  *
  * Please note that the byte order is undefined. Also the length of each
  *  type is not defined on a global scale and may differ across compilers or
@@ -84,7 +85,7 @@ public:
 
     /** @brief Returns the next character to be read by an actual parse.
      *
-     * @return the next character which will be returned
+     * @return the next character which will be returned, EOF at the end of the file
      */
     int peek();
 
@@ -96,9 +97,12 @@ public:
     std::string read(int numBytes);
 
 
-    /** @brief Returns the next character to be read by an actual parse.
+    /** @brief Puts the given character in front of the remaining input
      *
-     * @return the next character which will be returned
+     * The character is returned by the next read, it does not need to be
+     *  the one read before.
+     *
+     * @param[in] c The character to read next
      */
     void putback(char c);
 
@@ -219,17 +223,64 @@ public:
 private:
     int checkType(BinaryFormatter::DataType t);
 
+    /** @brief Copies the next bytes into the given memory and advances
+     *
+     * A character put back is copied first.
+     *
+     * @param[out] into The memory to copy the bytes into (0 to skip them)
+     * @param[in] numBytes The number of bytes to copy
+     * @exception ProcessError If the file ends before
+     */
+    void readBytes(void* into, int numBytes);
+
+    /// @brief Releases the memory mapping (if any)
+    void unmap();
+
 private:
-    /// @brief The encapsulated stream
-    std::ifstream myStream;
+    /// @brief The name of the read file (for error messages)
+    const std::string myName;
 
     const bool myAmTyped;
 
     /// @brief Information whether types shall be checked
     const bool myEnableValidation;
 
-    /// @brief The buffer used for string parsing
-    char myBuffer[10000];
+    /// @brief The begin of the file's contents (mapped or buffered)
+    const char* myData;
+
+    /// @brief The current read position
+    const char* myPos;
+
+    /// @brief The end of the file's contents
+    const char* myEnd;
+
+    /// @brief Whether the file could be read and no read went beyond its end
+    bool myAmGood;
+
+    /// @brief Whether a character was put back which has to be read next
+    bool myHasPutback;
+
+    /// @brief The character put back
+    char myPutback;
+
+    /// @brief The file's contents if they could not be mapped
+    std::vector<char> myBuffer;
+
+    /// @brief The mapped memory, 0 if the contents are buffered
+    void* myMapping;
+
+#ifdef WIN32
+    /// @brief The handles of the mapped file and of the mapping
+    void* myFileHandle;
+    void* myMappingHandle;
+#endif
+
+private:
+    /// @brief Invalidated copy constructor.
+    BinaryInputDevice(const BinaryInputDevice&);
+
+    /// @brief Invalidated assignment operator.
+    BinaryInputDevice& operator=(const BinaryInputDevice&);
 
 };
 
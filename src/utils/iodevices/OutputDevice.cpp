@@ -167,6 +167,37 @@ OutputDevice::closeAll() {
 }
 
 
+void
+OutputDevice::continueInNewFiles(const std::string& suffix) {
+    for (std::map<std::string, OutputDevice*>::iterator i = myOutputDevices.begin(); i != myOutputDevices.end(); ++i) {
+        OutputDevice_File* const dev = dynamic_cast<OutputDevice_File*>(i->second);
+        if (dev == 0 || i->first == "/dev/null"
+                || MsgHandler::getErrorInstance()->isRetriever(dev)
+                || MsgHandler::getWarningInstance()->isRetriever(dev)
+                || MsgHandler::getMessageInstance()->isRetriever(dev)) {
+            continue;
+        }
+        while (dev->closeTag()) {}
+        // insert the suffix in front of the extension of the last path component
+        std::string name = dev->getFullName();
+        const std::string::size_type dot = name.rfind('.');
+        const std::string::size_type sep = name.find_last_of("/\\");
+        if (dot == std::string::npos || (sep != std::string::npos && dot < sep)) {
+            name += suffix;
+        } else {
+            name.insert(dot, suffix);
+        }
+        dev->reopen(name);
+        OutputDevice* const base = i->second;
+        base->setPrecision();
+        base->getOStream() << std::setiosflags(std::ios::fixed);
+        if (base->myHeaderRoot != "") {
+            base->writeXMLHeader(base->myHeaderRoot, base->myHeaderAttrs, base->myHeaderComment);
+        }
+    }
+}
+
+
 std::string
 OutputDevice::realString(const SUMOReal v, const int precision) {
     std::ostringstream oss;
@@ -231,7 +262,13 @@ OutputDevice::setPrecision(int precision) {
 bool
 OutputDevice::writeXMLHeader(const std::string& rootElement,
                              const std::string& attrs, const std::string& comment) {
-    return myFormatter->writeXMLHeader(getOStream(), rootElement, attrs, comment);
+    if (myFormatter->writeXMLHeader(getOStream(), rootElement, attrs, comment)) {
+        myHeaderRoot = rootElement;
+        myHeaderAttrs = attrs;
+        myHeaderComment = comment;
+        return true;
+    }
+    return false;
 }
 
 
@@ -127,6 +127,19 @@ public:
     /**  Closes all registered devices
      */
     static void closeAll();
+
+
+    /** @brief Continues the output of all registered files in new files
+     *
+     * The open elements of each file are closed and the output continues in a
+     *  file whose name gets the given suffix in front of the extension. The
+     *  XML header written before is repeated in the new file. Files receiving
+     *  messages (the logs), "/dev/null" and non-file devices are kept.
+     *
+     * @param[in] suffix The suffix to add to the file names
+     * @exception IOError If one of the new files could not be built
+     */
+    static void continueInNewFiles(const std::string& suffix);
     /// @}
 
 
@@ -348,6 +361,15 @@ private:
 
     const bool myAmBinary;
 
+    /// @brief The root element of the written XML header (empty if none was written)
+    std::string myHeaderRoot;
+
+    /// @brief The attributes of the root element of the written XML header
+    std::string myHeaderAttrs;
+
+    /// @brief The comment of the written XML header
+    std::string myHeaderComment;
+
 public:
     /// @brief Invalidated copy constructor.
     OutputDevice(const OutputDevice&);
@@ -46,16 +46,7 @@
 // ===========================================================================
 OutputDevice_File::OutputDevice_File(const std::string& fullName, const bool binary)
     : OutputDevice(binary), myFileStream(0) {
-#ifdef WIN32
-    if (fullName == "/dev/null") {
-        myFileStream = new std::ofstream("NUL");
-    } else
-#endif
-        myFileStream = new std::ofstream(fullName.c_str(), binary ? std::ios::binary : std::ios_base::out);
-    if (!myFileStream->good()) {
-        delete myFileStream;
-        throw IOError("Could not build output file '" + fullName + "' (" + std::strerror(errno) + ").");
-    }
+    reopen(fullName);
 }
 
 
@@ -65,6 +56,29 @@ OutputDevice_File::~OutputDevice_File() {
 }
 
 
+void
+OutputDevice_File::reopen(const std::string& fullName) {
+    std::ofstream* stream = 0;
+#ifdef WIN32
+    if (fullName == "/dev/null") {
+        stream = new std::ofstream("NUL");
+    } else
+#endif
+        stream = new std::ofstream(fullName.c_str(), isBinary() ? std::ios::binary : std::ios_base::out);
+    if (!stream->good()) {
+        delete stream;
+        throw IOError("Could not build output file '" + fullName + "' (" + std::strerror(errno) + ").");
+    }
+    // the old file is kept until the new one could be built
+    if (myFileStream != 0) {
+        myFileStream->close();
+        delete myFileStream;
+    }
+    myFileStream = stream;
+    myFullName = fullName;
+}
+
+
 std::ostream&
 OutputDevice_File::getOStream() {
     return *myFileStream;
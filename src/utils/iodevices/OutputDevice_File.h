@@ -58,6 +58,19 @@ public:
     ~OutputDevice_File();
 
 
+    /// @brief Returns the name of the written file
+    const std::string& getFullName() const {
+        return myFullName;
+    }
+
+
+    /** @brief Closes the current file and continues writing into the named one
+     * @param[in] fullName The name of the file to write into
+     * @exception IOError If the file could not be built
+     */
+    void reopen(const std::string& fullName);
+
+
 protected:
     /// @name Methods that override/implement OutputDevice-methods
     /// @{
@@ -73,6 +86,8 @@ private:
     /// The wrapped ofstream
     std::ofstream* myFileStream;
 
+    /// @brief The name of the written file
+    std::string myFullName;
 };
 
 
@@ -33,6 +33,9 @@
 #ifdef HAVE_FOX
 #include <fx.h>
 #endif
+#include <vector>
+#include <algorithm>
+#include <limits>
 #include "IntermodalEdge.h"
 
 
@@ -134,13 +137,37 @@ private:
     struct Schedule {
         Schedule(const SUMOTime _begin, const SUMOTime _end, const SUMOTime _period, const SUMOReal _travelTimeSec)
             : begin(_begin), end(_end), period(_period), travelTimeSec(_travelTimeSec) {}
-        const SUMOTime begin;
-        const SUMOTime end;
-        const SUMOTime period;
-        const SUMOReal travelTimeSec;
-    private:
-        /// @brief Invalidated assignment operator
-        Schedule& operator=(const Schedule& src);
+        SUMOTime begin;
+        SUMOTime end;
+        SUMOTime period;
+        SUMOReal travelTimeSec;
+    };
+
+    /// @brief a non-repeating schedule which may be used by queries before endSec
+    struct Departure {
+        Departure(const SUMOReal _endSec, const SUMOReal _arrivalSec)
+            : endSec(_endSec), arrivalSec(_arrivalSec), minArrivalSec(_arrivalSec) {}
+        SUMOReal endSec;
+        SUMOReal arrivalSec;
+        /// @brief the earliest arrival of this and all following departures
+        SUMOReal minArrivalSec;
+    };
+
+    /// @brief sorts schedules by begin
+    struct schedule_by_begin_sorter {
+        bool operator()(const Schedule& s1, const Schedule& s2) const {
+            return s1.begin < s2.begin;
+        }
+    };
+
+    /// @brief sorts departures by end
+    struct departure_by_end_sorter {
+        bool operator()(const Departure& d1, const Departure& d2) const {
+            return d1.endSec < d2.endSec;
+        }
+        bool operator()(const SUMOReal time, const Departure& d) const {
+            return time < d.endSec;
+        }
     };
 
 public:
@@ -156,26 +183,49 @@ public:
     }
 
     void addSchedule(const SUMOTime begin, const SUMOTime end, const SUMOTime period, const SUMOReal travelTimeSec) {
-        mySchedules.insert(std::make_pair(STEPS2TIME(begin), Schedule(begin, end, period, travelTimeSec)));
+        if (period < 0 && end <= begin) {
+            // a single vehicle which always departs at begin (if usable at all)
+            const Departure dep(STEPS2TIME(end), STEPS2TIME(begin) + travelTimeSec);
+            typename std::vector<Departure>::iterator it = mySingleDepartures.insert(
+                        std::upper_bound(mySingleDepartures.begin(), mySingleDepartures.end(), dep, departure_by_end_sorter()), dep);
+            if (it + 1 != mySingleDepartures.end()) {
+                it->minArrivalSec = MIN2(it->arrivalSec, (it + 1)->minArrivalSec);
+            }
+            while (it != mySingleDepartures.begin()) {
+                --it;
+                it->minArrivalSec = MIN2(it->minArrivalSec, dep.arrivalSec);
+            }
+        } else {
+            const Schedule schedule(begin, end, period, travelTimeSec);
+            mySchedules.insert(std::upper_bound(mySchedules.begin(), mySchedules.end(), schedule, schedule_by_begin_sorter()), schedule);
+        }
     }
 
     SUMOReal getTravelTime(const IntermodalTrip<E, N, V>* const /* trip */, SUMOReal time) const {
         SUMOReal minArrivalSec = std::numeric_limits<SUMOReal>::max();
-        for (typename std::multimap<SUMOReal, Schedule>::const_iterator it = mySchedules.begin(); it != mySchedules.end(); ++it) {
-            if (it->first > minArrivalSec) {
+        // all single departures which are still usable follow the first one
+        typename std::vector<Departure>::const_iterator dep = std::upper_bound(mySingleDepartures.begin(), mySingleDepartures.end(), time, departure_by_end_sorter());
+        if (dep != mySingleDepartures.end()) {
+            minArrivalSec = dep->minArrivalSec;
+        }
+        for (typename std::vector<Schedule>::const_iterator it = mySchedules.begin(); it != mySchedules.end(); ++it) {
+            if (STEPS2TIME(it->begin) > minArrivalSec) {
                 break;
             }
-            if (time < STEPS2TIME(it->second.end)) {
-                const long long int running = MAX2((SUMOTime)0, TIME2STEPS(time) - it->second.begin) / it->second.period;
-                const SUMOTime nextDepart = it->second.begin + running * it->second.period;
-                minArrivalSec = MIN2(STEPS2TIME(nextDepart) + it->second.travelTimeSec, minArrivalSec);
+            if (time < STEPS2TIME(it->end)) {
+                const long long int running = MAX2((SUMOTime)0, TIME2STEPS(time) - it->begin) / it->period;
+                const SUMOTime nextDepart = it->begin + running * it->period;
+                minArrivalSec = MIN2(STEPS2TIME(nextDepart) + it->travelTimeSec, minArrivalSec);
             }
         }
         return minArrivalSec - time;
     }
 
 private:
-    std::multimap<SUMOReal, Schedule> mySchedules;
+    /// @brief the repeating schedules sorted by begin
+    std::vector<Schedule> mySchedules;
+    /// @brief the non-repeating schedules sorted by the time until which they may be used
+    std::vector<Departure> mySingleDepartures;
     const IntermodalEdge<E, L, N, V>* const myEntryStop;
 
 };
@@ -0,0 +1,265 @@
+/****************************************************************************/
+/// @file    RouteCache.h
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A thread-safe cache of routing results and a router using it
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef RouteCache_h
+#define RouteCache_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <map>
+#include <string>
+#include <vector>
+#include <utils/common/SUMOTime.h>
+#include <utils/common/SUMOVehicleClass.h>
+#include <utils/common/ToString.h>
+#include "SUMOAbstractRouter.h"
+#ifdef HAVE_FOX
+#include <fx.h>
+#include <FXThread.h>
+#endif
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class RouteCache
+ * @brief Stores the routes found between origin/destination pairs
+ *
+ * Routes are stored per origin, destination, vehicle class and time slot.
+ *  The cache has to be invalidated whenever the edge weights the routes
+ *  were computed with change. Each invalidation starts a new epoch; results
+ *  of queries started within an earlier epoch are not stored, so a query
+ *  still running in another thread cannot bring outdated routes into the cache.
+ *  All methods may be called from several threads.
+ */
+template<class E>
+class RouteCache {
+public:
+    /// @brief Constructor
+    RouteCache() : myEpoch(0), myHits(0), myMisses(0)
+#ifdef HAVE_FOX
+        , myLock(true)
+#endif
+    {}
+
+
+    /** @brief Retrieves a stored route
+     *
+     * The edges are appended to the given vector if a route is known.
+     *
+     * @param[in] from The origin edge
+     * @param[in] to The destination edge
+     * @param[in] vClass The class of the routed vehicle
+     * @param[in] slot The time slot of the query
+     * @param[filled] into The vector to append the route's edges to
+     * @return Whether a route was found
+     */
+    bool get(const E* from, const E* to, SUMOVehicleClass vClass, SUMOTime slot, std::vector<const E*>& into) {
+#ifdef HAVE_FOX
+        FXMutexLock f(myLock);
+#endif
+        typename RouteMap::const_iterator i = myRoutes.find(Key(Pair(from, to), std::make_pair(vClass, slot)));
+        if (i == myRoutes.end()) {
+            myMisses++;
+            return false;
+        }
+        myHits++;
+        into.insert(into.end(), i->second.begin(), i->second.end());
+        return true;
+    }
+
+
+    /** @brief Stores a route found by a query started in the given epoch
+     *
+     * @param[in] from The origin edge
+     * @param[in] to The destination edge
+     * @param[in] vClass The class of the routed vehicle
+     * @param[in] slot The time slot of the query
+     * @param[in] epoch The epoch the query was started in
+     * @param[in] begin The begin of the route's edges
+     * @param[in] end The end of the route's edges
+     */
+    void add(const E* from, const E* to, SUMOVehicleClass vClass, SUMOTime slot, int epoch,
+             typename std::vector<const E*>::const_iterator begin,
+             typename std::vector<const E*>::const_iterator end) {
+#ifdef HAVE_FOX
+        FXMutexLock f(myLock);
+#endif
+        if (epoch == myEpoch) {
+            myRoutes[Key(Pair(from, to), std::make_pair(vClass, slot))].assign(begin, end);
+        }
+    }
+
+
+    /// @brief Returns the current epoch
+    int getEpoch() {
+#ifdef HAVE_FOX
+        FXMutexLock f(myLock);
+#endif
+        return myEpoch;
+    }
+
+
+    /// @brief Removes all routes and starts a new epoch (to be called when the edge weights change)
+    void invalidate() {
+#ifdef HAVE_FOX
+        FXMutexLock f(myLock);
+#endif
+        myRoutes.clear();
+        myEpoch++;
+    }
+
+
+    /// @brief Returns the number of queries answered from the cache
+    long long int getHits() const {
+        return myHits;
+    }
+
+
+    /// @brief Returns the number of queries which had to be routed
+    long long int getMisses() const {
+        return myMisses;
+    }
+
+
+    /// @brief Returns a description of the hit rate for the statistics output, "" if unused
+    std::string getStatistics() const {
+        const long long int queries = myHits + myMisses;
+        if (queries == 0) {
+            return "";
+        }
+        return toString(myHits) + " of " + toString(queries) + " queries answered from cache (" + toString(100. * (double)myHits / (double)queries) + "%)";
+    }
+
+
+private:
+    typedef std::pair<const E*, const E*> Pair;
+    typedef std::pair<Pair, std::pair<SUMOVehicleClass, SUMOTime> > Key;
+    typedef std::map<Key, std::vector<const E*> > RouteMap;
+
+    /// @brief The stored routes
+    RouteMap myRoutes;
+
+    /// @brief The number of invalidations so far
+    int myEpoch;
+
+    /// @brief The statistics counters
+    long long int myHits;
+    long long int myMisses;
+
+#ifdef HAVE_FOX
+    /// @brief The mutex guarding all members
+    FXMutex myLock;
+#endif
+
+
+private:
+    /// @brief Invalidated copy constructor
+    RouteCache(const RouteCache& s);
+
+    /// @brief Invalidated assignment operator
+    RouteCache& operator=(const RouteCache& s);
+};
+
+
+/**
+ * @class CachedRouter
+ * @brief A router answering repeated queries from a RouteCache
+ *
+ * Wraps another router which is asked if the cache does not know a route
+ *  yet. Vehicles of the same class share their routes, so this should only
+ *  be used if the edge weights do not depend on further vehicle properties
+ *  (or if these differences may be neglected). If the weights are time
+ *  dependent, the given period splits the time into slots which are cached
+ *  separately.
+ */
+template<class E, class V>
+class CachedRouter : public SUMOAbstractRouter<E, V> {
+public:
+    /** @brief Constructor
+     *
+     * @param[in] router The router to use for unknown routes (deleted by this)
+     * @param[in] cache The cache to use (may be shared between routers)
+     * @param[in] period The length of a time slot, 0 for time independent weights
+     */
+    CachedRouter(SUMOAbstractRouter<E, V>* router, RouteCache<E>& cache, SUMOTime period) :
+        SUMOAbstractRouter<E, V>(0, "CachedRouter"), myRouter(router), myCache(cache), myPeriod(period) {
+    }
+
+    /// @brief Destructor
+    virtual ~CachedRouter() {
+        delete myRouter;
+    }
+
+    virtual SUMOAbstractRouter<E, V>* clone() {
+        return new CachedRouter<E, V>(myRouter->clone(), myCache, myPeriod);
+    }
+
+    virtual bool compute(const E* from, const E* to, const V* const vehicle,
+                         SUMOTime msTime, std::vector<const E*>& into) {
+        const SUMOVehicleClass vClass = vehicle == 0 ? SVC_IGNORING : vehicle->getVClass();
+        const SUMOTime slot = myPeriod > 0 ? msTime / myPeriod : 0;
+        if (myCache.get(from, to, vClass, slot, into)) {
+            return true;
+        }
+        const int epoch = myCache.getEpoch();
+        const int oldSize = (int)into.size();
+        const bool result = myRouter->compute(from, to, vehicle, msTime, into);
+        if (result && (int)into.size() > oldSize) {
+            myCache.add(from, to, vClass, slot, epoch, into.begin() + oldSize, into.end());
+        }
+        return result;
+    }
+
+    virtual SUMOReal recomputeCosts(const std::vector<const E*>& edges,
+                                    const V* const v, SUMOTime msTime) const {
+        return myRouter->recomputeCosts(edges, v, msTime);
+    }
+
+    virtual void setBulkMode(const bool mode) {
+        myRouter->setBulkMode(mode);
+    }
+
+private:
+    /// @brief The router computing unknown routes
+    SUMOAbstractRouter<E, V>* const myRouter;
+
+    /// @brief The cache of known routes
+    RouteCache<E>& myCache;
+
+    /// @brief The length of the time slots cached separately
+    const SUMOTime myPeriod;
+
+private:
+    /// @brief Invalidated assignment operator
+    CachedRouter& operator=(const CachedRouter& s);
+};
+
+
+#endif
+
+/****************************************************************************/
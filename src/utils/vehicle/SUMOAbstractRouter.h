@@ -98,7 +98,7 @@ public:
         myQueryTimeSum += (SysUtils::getCurrentMillis() - myQueryStartTime);
     }
 
-    void setBulkMode(const bool mode) {
+    virtual void setBulkMode(const bool mode) {
         myBulkMode = mode;
     }
 
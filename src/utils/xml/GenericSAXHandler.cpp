@@ -56,14 +56,22 @@ GenericSAXHandler::GenericSAXHandler(
     : myParentHandler(0), myParentIndicator(SUMO_TAG_NOTHING), myFileName(file) {
     int i = 0;
     while (tags[i].key != terminatorTag) {
-        myTagMap.insert(TagMap::value_type(tags[i].str, tags[i].key));
+        XMLCh* const tag = convert(tags[i].str);
+        if (!myTagMap.insert(TagMap::value_type(tag, std::make_pair(tags[i].key, std::string(tags[i].str)))).second) {
+            delete[] tag;
+        }
         i++;
     }
     i = 0;
     while (attrs[i].key != terminatorAttr) {
         assert(myPredefinedTags.find(attrs[i].key) == myPredefinedTags.end());
+        assert(attrs[i].key >= 0);
         myPredefinedTags[attrs[i].key] = convert(attrs[i].str);
         myPredefinedTagsMML[attrs[i].key] = attrs[i].str;
+        myAttrIDs.insert(std::make_pair(myPredefinedTags[attrs[i].key], attrs[i].key));
+        if (attrs[i].key >= (int)myAttrIndex.size()) {
+            myAttrIndex.resize(attrs[i].key + 1, -1);
+        }
         i++;
     }
 }
@@ -73,6 +81,9 @@ GenericSAXHandler::~GenericSAXHandler() {
     for (AttrMap::iterator i1 = myPredefinedTags.begin(); i1 != myPredefinedTags.end(); i1++) {
         delete[](*i1).second;
     }
+    for (TagMap::iterator i2 = myTagMap.begin(); i2 != myTagMap.end(); i2++) {
+        delete[](*i2).first;
+    }
 }
 
 
@@ -106,10 +117,11 @@ GenericSAXHandler::startElement(const XMLCh* const /*uri*/,
                                 const XMLCh* const /*localname*/,
                                 const XMLCh* const qname,
                                 const XERCES_CPP_NAMESPACE::Attributes& attrs) {
-    std::string name = TplConvert::_2str(qname);
-    int element = convertTag(name);
+    std::string name;
+    int element = convertTag(qname, &name);
     myCharactersVector.clear();
-    SUMOSAXAttributesImpl_Xerces na(attrs, myPredefinedTags, myPredefinedTagsMML, name);
+    indexAttributes(attrs);
+    SUMOSAXAttributesImpl_Xerces na(attrs, myAttrIndex, myPredefinedTagsMML, name);
     if (element == SUMO_TAG_INCLUDE) {
         std::string file = na.getString(SUMO_ATTR_HREF);
         if (!FileHelpers::isAbsolute(file)) {
@@ -126,8 +138,7 @@ void
 GenericSAXHandler::endElement(const XMLCh* const /*uri*/,
                               const XMLCh* const /*localname*/,
                               const XMLCh* const qname) {
-    std::string name = TplConvert::_2str(qname);
-    int element = convertTag(name);
+    int element = convertTag(qname);
     // collect characters
     if (myCharactersVector.size() != 0) {
         int len = 0;
@@ -179,12 +190,36 @@ GenericSAXHandler::characters(const XMLCh* const chars,
 
 
 int
-GenericSAXHandler::convertTag(const std::string& tag) const {
+GenericSAXHandler::convertTag(const XMLCh* const tag, std::string* name) const {
     TagMap::const_iterator i = myTagMap.find(tag);
     if (i == myTagMap.end()) {
+        if (name != 0) {
+            *name = TplConvert::_2str(tag);
+        }
         return SUMO_TAG_NOTHING;
     }
-    return (*i).second;
+    if (name != 0) {
+        *name = (*i).second.second;
+    }
+    return (*i).second.first;
+}
+
+
+void
+GenericSAXHandler::indexAttributes(const XERCES_CPP_NAMESPACE::Attributes& attrs) {
+    for (std::vector<int>::const_iterator i = myIndexedAttrs.begin(); i != myIndexedAttrs.end(); ++i) {
+        myAttrIndex[*i] = -1;
+    }
+    myIndexedAttrs.clear();
+    for (int i = 0; i < (int)attrs.getLength(); ++i) {
+        std::pair<AttrIDMap::const_iterator, AttrIDMap::const_iterator> ids = myAttrIDs.equal_range(attrs.getQName(i));
+        for (AttrIDMap::const_iterator j = ids.first; j != ids.second; ++j) {
+            if (myAttrIndex[(*j).second] < 0) {
+                myAttrIndex[(*j).second] = i;
+                myIndexedAttrs.push_back((*j).second);
+            }
+        }
+    }
 }
 
 
@@ -38,6 +38,7 @@
 #include <sstream>
 #include <vector>
 #include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/util/XMLString.hpp>
 #include <xercesc/sax2/DefaultHandler.hpp>
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/StringBijection.h>
@@ -270,17 +271,36 @@ private:
 
 
     /**
-     * @brief Converts a tag from its string into its numerical representation
+     * @brief Converts a tag from its unicode-string into its numerical representation
      *
      * Returns the enum-representation stored for the given tag. If the tag is not
-     *  known, SUMO_TAG_NOTHING is returned.
+     *  known, SUMO_TAG_NOTHING is returned. The tag is looked up without being
+     *  transcoded (the name is transcoded only for unknown tags).
      * @param[in] tag The string to convert
+     * @param[out] name If not 0, the tag's name is stored herein
      * @return The int-value that represents the string, SUMO_TAG_NOTHING if the named attribute is not known
      */
-    int convertTag(const std::string& tag) const;
+    int convertTag(const XMLCh* const tag, std::string* name = 0) const;
+
+
+    /** @brief Determines the positions of the known attributes within the given attributes
+     *
+     * Fills myAttrIndex so that the attributes of the current element may be
+     *  retrieved by their id without comparing names.
+     * @param[in] attrs The attributes of the current element
+     */
+    void indexAttributes(const XERCES_CPP_NAMESPACE::Attributes& attrs);
 
 
 private:
+    /// @brief orders unicode-strings (allows looking up names without transcoding them)
+    struct xmlch_less {
+        bool operator()(const XMLCh* const s1, const XMLCh* const s2) const {
+            return XERCES_CPP_NAMESPACE::XMLString::compareString(s1, s2) < 0;
+        }
+    };
+
+
     /// @name attributes parsing
     //@{
 
@@ -292,14 +312,26 @@ private:
 
     /// the map from ids to their string representation
     std::map<int, std::string> myPredefinedTagsMML;
+
+    // the type of the map from the unicode-string representation of attributes to their ids
+    typedef std::multimap<const XMLCh*, int, xmlch_less> AttrIDMap;
+
+    /// @brief the map from the unicode-string representation of attributes to their ids
+    AttrIDMap myAttrIDs;
+
+    /// @brief the position of each attribute (by id) within the current element's attributes, -1 if not given
+    std::vector<int> myAttrIndex;
+
+    /// @brief the ids of the attributes given for the current element (entries of myAttrIndex to reset)
+    std::vector<int> myIndexedAttrs;
     //@}
 
 
     /// @name elements parsing
     //@{
 
-    // the type of the map that maps tag names to ints
-    typedef std::map<std::string, int> TagMap;
+    // the type of the map that maps tag names (in unicode) to ints and their string representation
+    typedef std::map<const XMLCh*, std::pair<int, std::string>, xmlch_less> TagMap;
 
     // the map of tag names to their internal numerical representation
     TagMap myTagMap;
@@ -52,12 +52,12 @@
 // class definitions
 // ===========================================================================
 SUMOSAXAttributesImpl_Xerces::SUMOSAXAttributesImpl_Xerces(const XERCES_CPP_NAMESPACE::Attributes& attrs,
-        const std::map<int, XMLCh*>& predefinedTags,
+        const std::vector<int>& attrIndex,
         const std::map<int, std::string>& predefinedTagsMML,
         const std::string& objectType) :
     SUMOSAXAttributes(objectType),
     myAttrs(attrs),
-    myPredefinedTags(predefinedTags),
+    myAttrIndex(attrIndex),
     myPredefinedTagsMML(predefinedTagsMML) { }
 
 
@@ -67,11 +67,7 @@ SUMOSAXAttributesImpl_Xerces::~SUMOSAXAttributesImpl_Xerces() {
 
 bool
 SUMOSAXAttributesImpl_Xerces::hasAttribute(int id) const {
-    AttrMap::const_iterator i = myPredefinedTags.find(id);
-    if (i == myPredefinedTags.end()) {
-        return false;
-    }
-    return myAttrs.getIndex((*i).second) >= 0;
+    return id >= 0 && id < (int)myAttrIndex.size() && myAttrIndex[id] >= 0;
 }
 
 
@@ -150,9 +146,9 @@ SUMOSAXAttributesImpl_Xerces::getFloat(int id) const {
 
 const XMLCh*
 SUMOSAXAttributesImpl_Xerces::getAttributeValueSecure(int id) const {
-    AttrMap::const_iterator i = myPredefinedTags.find(id);
-    assert(i != myPredefinedTags.end());
-    return myAttrs.getValue((*i).second);
+    assert(id >= 0 && id < (int)myAttrIndex.size());
+    const int index = myAttrIndex[id];
+    return index < 0 ? 0 : myAttrs.getValue((XMLSize_t)index);
 }
 
 
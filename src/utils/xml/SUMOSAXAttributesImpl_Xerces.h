@@ -34,6 +34,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <iostream>
 #include <xercesc/sax2/Attributes.hpp>
 #include <utils/common/SUMOTime.h>
@@ -55,11 +56,11 @@ public:
     /** @brief Constructor
      *
      * @param[in] attrs The encapsulated xerces-attributes
-     * @param[in] predefinedTags Map of attribute ids to their xerces-representation
+     * @param[in] attrIndex The positions of the attributes (by id) within attrs, -1 for missing ones
      * @param[in] predefinedTagsMML Map of attribute ids to their (readable) string-representation
      */
     SUMOSAXAttributesImpl_Xerces(const XERCES_CPP_NAMESPACE::Attributes& attrs,
-                                 const std::map<int, XMLCh*>& predefinedTags,
+                                 const std::vector<int>& attrIndex,
                                  const std::map<int, std::string>& predefinedTagsMML,
                                  const std::string& objectType);
 
@@ -301,10 +302,8 @@ private:
     /// @brief The encapsulated attributes
     const XERCES_CPP_NAMESPACE::Attributes& myAttrs;
 
-    /// @brief Definition of a map of attribute ids to their xerces-representation
-    typedef std::map<int, XMLCh*> AttrMap;
-    /// @brief Map of attribute ids to their xerces-representation
-    const AttrMap& myPredefinedTags;
+    /// @brief The positions of the attributes (by id) within myAttrs, -1 for missing ones
+    const std::vector<int>& myAttrIndex;
 
     /// @brief Map of attribute ids to their (readable) string-representation
     const std::map<int, std::string>& myPredefinedTagsMML;
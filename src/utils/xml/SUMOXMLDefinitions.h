@@ -384,6 +384,8 @@ enum SumoXMLAttr {
     SUMO_ATTR_PERSON_NUMBER,
     SUMO_ATTR_CONTAINER_NUMBER,
     SUMO_ATTR_MODES,
+    /// the number of random numbers a vehicle drew from its own stream (state files)
+    SUMO_ATTR_RANDOM_DRAWS,
     /* source definitions */
     SUMO_ATTR_FUNCTION,
     SUMO_ATTR_POSITION,
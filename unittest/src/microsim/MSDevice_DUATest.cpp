@@ -0,0 +1,201 @@
+/****************************************************************************/
+/// @file    MSDevice_DUATest.cpp
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the route choice and travel time aggregation of MSDevice_DUA
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <utils/options/OptionsCont.h>
+#include <utils/vehicle/RouteCostCalculator.h>
+#include <microsim/MSEdge.h>
+#include <microsim/devices/MSDevice_DUA.h>
+
+/*
+Tests the static route choice and travel time methods of MSDevice_DUA from <SUMO>/src/microsim/devices
+*/
+
+typedef MSDevice_DUA::RouteAlternative RouteAlternative;
+typedef GawronCalculator<RouteAlternative, MSEdge, SUMOVehicle> Gawron;
+
+
+class MSDevice_DUATest : public testing::Test {
+protected :
+    MSEdge* a;
+    MSEdge* b;
+    MSEdge* c;
+    ConstMSEdgeVector routeA;
+    ConstMSEdgeVector routeB;
+    ConstMSEdgeVector routeC;
+
+    virtual void SetUp() {
+        OptionsCont& oc = OptionsCont::getOptions();
+        oc.clear();
+        oc.addOptionSubTopic("Routing");
+        MSDevice_DUA::insertOptions(oc);
+        a = new MSEdge("a", 0, MSEdge::EDGEFUNCTION_NORMAL, "", "", 0);
+        b = new MSEdge("b", 1, MSEdge::EDGEFUNCTION_NORMAL, "", "", 0);
+        c = new MSEdge("c", 2, MSEdge::EDGEFUNCTION_NORMAL, "", "", 0);
+        routeA.push_back(a);
+        routeB.push_back(a);
+        routeB.push_back(b);
+        routeC.push_back(a);
+        routeC.push_back(c);
+    }
+
+    virtual void TearDown() {
+        MSDevice_DUA::cleanup();
+        delete a;
+        delete b;
+        delete c;
+    }
+
+    static SUMOReal sum(const std::vector<RouteAlternative>& routes) {
+        SUMOReal result = 0;
+        for (std::vector<RouteAlternative>::const_iterator i = routes.begin(); i != routes.end(); ++i) {
+            result += i->getProbability();
+        }
+        return result;
+    }
+};
+
+
+/* Test that empty and known routes are not added as alternatives. */
+TEST_F(MSDevice_DUATest, test_method_addAlternative) {
+    std::vector<RouteAlternative> routes;
+    EXPECT_FALSE(MSDevice_DUA::addAlternative(routes, ConstMSEdgeVector()));
+    EXPECT_TRUE(MSDevice_DUA::addAlternative(routes, routeA));
+    EXPECT_FALSE(MSDevice_DUA::addAlternative(routes, routeA));
+    EXPECT_TRUE(MSDevice_DUA::addAlternative(routes, routeB));
+    EXPECT_FALSE(MSDevice_DUA::addAlternative(routes, routeB));
+    EXPECT_EQ(2, (int)routes.size());
+    EXPECT_TRUE(routes[0].hasEdges(routeA));
+    EXPECT_TRUE(routes[1].hasEdges(routeB));
+    EXPECT_FALSE(routes[1].hasEdges(routeC));
+}
+
+
+/* Test that the alternative is chosen according to the cumulated probabilities. */
+TEST_F(MSDevice_DUATest, test_method_chooseAlternative) {
+    std::vector<RouteAlternative> routes;
+    routes.push_back(RouteAlternative(routeA));
+    EXPECT_EQ(0, MSDevice_DUA::chooseAlternative(routes, 0.9));
+    routes[0].setProbability(0.25);
+    routes.push_back(RouteAlternative(routeB));
+    routes[1].setProbability(0.5);
+    routes.push_back(RouteAlternative(routeC));
+    routes[2].setProbability(0.25);
+    EXPECT_EQ(0, MSDevice_DUA::chooseAlternative(routes, 0.));
+    EXPECT_EQ(0, MSDevice_DUA::chooseAlternative(routes, 0.2));
+    EXPECT_EQ(0, MSDevice_DUA::chooseAlternative(routes, 0.25));
+    EXPECT_EQ(1, MSDevice_DUA::chooseAlternative(routes, 0.3));
+    EXPECT_EQ(1, MSDevice_DUA::chooseAlternative(routes, 0.7));
+    EXPECT_EQ(2, MSDevice_DUA::chooseAlternative(routes, 0.8));
+    EXPECT_EQ(2, MSDevice_DUA::chooseAlternative(routes, 0.999));
+}
+
+
+/* Test the costs and probabilities after a new route was added. */
+TEST_F(MSDevice_DUATest, test_method_updateAlternatives_newRoute) {
+    Gawron calculator(0.3, 0.05);
+    std::vector<RouteAlternative> routes;
+    MSDevice_DUA::addAlternative(routes, routeA);
+    routes[0].setCosts(100);
+    MSDevice_DUA::addAlternative(routes, routeB);
+    std::vector<SUMOReal> costs;
+    costs.push_back(100);
+    costs.push_back(50);
+    MSDevice_DUA::updateAlternatives(routes, costs, true, 0, calculator, 0, 0);
+    ASSERT_EQ(2, (int)routes.size());
+    // the used route gets its current costs, the new one its initial costs
+    EXPECT_DOUBLE_EQ(100, routes[0].getCosts());
+    EXPECT_DOUBLE_EQ(50, routes[1].getCosts());
+    // starting with 1/2 each the cheaper route becomes more probable
+    EXPECT_GT(routes[1].getProbability(), 0.5);
+    EXPECT_LT(routes[0].getProbability(), 0.5);
+    EXPECT_NEAR(1., sum(routes), 1e-9);
+}
+
+
+/* Test that the costs of unused alternatives are smoothed using Gawron's beta. */
+TEST_F(MSDevice_DUATest, test_method_updateAlternatives_costs) {
+    Gawron calculator(0.3, 0.05);
+    std::vector<RouteAlternative> routes;
+    MSDevice_DUA::addAlternative(routes, routeA);
+    MSDevice_DUA::addAlternative(routes, routeB);
+    routes[0].setCosts(100);
+    routes[0].setProbability(0.5);
+    routes[1].setCosts(100);
+    routes[1].setProbability(0.5);
+    std::vector<SUMOReal> costs;
+    costs.push_back(200);
+    costs.push_back(200);
+    MSDevice_DUA::updateAlternatives(routes, costs, false, 0, calculator, 0, 0);
+    ASSERT_EQ(2, (int)routes.size());
+    EXPECT_DOUBLE_EQ(200, routes[0].getCosts());
+    EXPECT_DOUBLE_EQ(0.3 * 200 + 0.7 * 100, routes[1].getCosts());
+    // the unused route looks cheaper now
+    EXPECT_GT(routes[1].getProbability(), routes[0].getProbability());
+    EXPECT_NEAR(1., sum(routes), 1e-9);
+}
+
+
+/* Test that only the most probable alternatives are kept. */
+TEST_F(MSDevice_DUATest, test_method_updateAlternatives_prune) {
+    OptionsCont::getOptions().set("max-alternatives", "2");
+    Gawron calculator(0.3, 0.05);
+    EXPECT_EQ(2, calculator.getMaxRouteNumber());
+    std::vector<RouteAlternative> routes;
+    MSDevice_DUA::addAlternative(routes, routeA);
+    MSDevice_DUA::addAlternative(routes, routeB);
+    routes[0].setCosts(100);
+    routes[0].setProbability(0.5);
+    routes[1].setCosts(300);
+    routes[1].setProbability(0.5);
+    MSDevice_DUA::addAlternative(routes, routeC);
+    std::vector<SUMOReal> costs;
+    costs.push_back(100);
+    costs.push_back(300);
+    costs.push_back(120);
+    MSDevice_DUA::updateAlternatives(routes, costs, true, 0, calculator, 0, 0);
+    ASSERT_EQ(2, (int)routes.size());
+    // the most expensive route is dropped, the others are sorted by probability
+    EXPECT_TRUE(routes[0].hasEdges(routeA));
+    EXPECT_TRUE(routes[1].hasEdges(routeC));
+    EXPECT_GE(routes[0].getProbability(), routes[1].getProbability());
+    EXPECT_NEAR(1., sum(routes), 1e-9);
+}
+
+
+/* Test the averaging of the measured travel times. */
+TEST_F(MSDevice_DUATest, test_method_finishIteration) {
+    MSDevice_DUA::addMeasurement(2, 1, 10);
+    MSDevice_DUA::addMeasurement(2, 1, 20);
+    MSDevice_DUA::addMeasurement(0, 0, 5);
+    // nothing is known before the iteration is finished
+    EXPECT_DOUBLE_EQ(-1, MSDevice_DUA::getMeasuredTravelTime(2, 1));
+    MSDevice_DUA::finishIteration();
+    EXPECT_DOUBLE_EQ(15, MSDevice_DUA::getMeasuredTravelTime(2, 1));
+    EXPECT_DOUBLE_EQ(5, MSDevice_DUA::getMeasuredTravelTime(0, 0));
+    EXPECT_DOUBLE_EQ(-1, MSDevice_DUA::getMeasuredTravelTime(2, 0));
+    EXPECT_DOUBLE_EQ(-1, MSDevice_DUA::getMeasuredTravelTime(1, 0));
+    EXPECT_DOUBLE_EQ(-1, MSDevice_DUA::getMeasuredTravelTime(0, 3));
+    EXPECT_DOUBLE_EQ(-1, MSDevice_DUA::getMeasuredTravelTime(7, 0));
+    // the measurements of an iteration only replace the previous ones
+    MSDevice_DUA::addMeasurement(0, 0, 7);
+    MSDevice_DUA::finishIteration();
+    EXPECT_DOUBLE_EQ(7, MSDevice_DUA::getMeasuredTravelTime(0, 0));
+    EXPECT_DOUBLE_EQ(-1, MSDevice_DUA::getMeasuredTravelTime(2, 1));
+}
@@ -41,3 +41,65 @@ TEST(MSEventControl, test_method_execute) {
 
 
 
+
+
+/* A command which counts its executions and deletions and may be rescheduled. */
+class ShiftableCommand : public Command {
+public:
+    ShiftableCommand(bool keep, int& executed, int& deleted) :
+        myKeep(keep), myExecuted(executed), myDeleted(deleted) {}
+
+    ~ShiftableCommand() {
+        myDeleted++;
+    }
+
+    SUMOTime execute(SUMOTime) {
+        myExecuted++;
+        return 0;
+    }
+
+    SUMOTime shiftTime(SUMOTime currentTime, SUMOTime execTime, SUMOTime newTime) {
+        return myKeep ? execTime - currentTime + newTime : -1;
+    }
+
+private:
+    bool myKeep;
+    int& myExecuted;
+    int& myDeleted;
+};
+
+
+/* Test the method 'clearState'. Tests that the events are moved or deleted as their commands wish.*/
+
+TEST(MSEventControl, test_method_clearState) {
+    int executed = 0;
+    int deleted = 0;
+    MSEventControl eventControl;
+    eventControl.setCurrentTimeStep(100000);
+    eventControl.addEvent(new ShiftableCommand(true, executed, deleted), 150000, MSEventControl::NO_CHANGE);
+    eventControl.addEvent(new ShiftableCommand(false, executed, deleted), 120000, MSEventControl::NO_CHANGE);
+    eventControl.clearState(100000, 0);
+    EXPECT_EQ(1, deleted);
+    eventControl.setCurrentTimeStep(0);
+    eventControl.execute(40000);
+    EXPECT_EQ(0, executed);
+    eventControl.execute(50000);
+    EXPECT_EQ(1, executed);
+    EXPECT_EQ(2, deleted);
+    EXPECT_TRUE(eventControl.isEmpty());
+}
+
+
+/* Test that 'clearState' refuses commands which cannot be rescheduled and keeps the events.*/
+
+TEST(MSEventControl, test_method_clearState_refused) {
+    int executed = 0;
+    int deleted = 0;
+    MSEventControl eventControl;
+    eventControl.setCurrentTimeStep(100000);
+    eventControl.addEvent(new ShiftableCommand(true, executed, deleted), 150000, MSEventControl::NO_CHANGE);
+    eventControl.addEvent(new CommandMock(), 120000, MSEventControl::NO_CHANGE);
+    EXPECT_THROW(eventControl.clearState(100000, 0), ProcessError);
+    EXPECT_FALSE(eventControl.isEmpty());
+    EXPECT_EQ(0, deleted);
+}
@@ -0,0 +1,91 @@
+/****************************************************************************/
+/// @file    MSStepProfilerTest.cpp
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the class MSStepProfiler
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+#include <utils/options/OptionsCont.h>
+#include <utils/options/Option.h>
+#include <utils/iodevices/OutputDevice.h>
+#include <microsim/MSStepProfiler.h>
+
+/*
+Tests MSStepProfiler class from <SUMO>/src/microsim
+*/
+
+/* Test that nothing is measured if no output is set. */
+TEST(MSStepProfiler, test_disabled) {
+    OptionsCont& oc = OptionsCont::getOptions();
+    oc.clear();
+    oc.doRegister("step-profile", new Option_FileName());
+    MSStepProfiler::init();
+    EXPECT_FALSE(MSStepProfiler::isEnabled());
+    {
+        STEP_PROFILE_PHASE(EVENTS);
+    }
+    oc.clear();
+}
+
+
+/* Test the step and summary output. */
+TEST(MSStepProfiler, test_output) {
+    const std::string file = "MSStepProfilerTest.xml";
+    OptionsCont& oc = OptionsCont::getOptions();
+    oc.clear();
+    oc.doRegister("output-prefix", new Option_String());
+    oc.doRegister("step-profile", new Option_FileName());
+    oc.set("step-profile", file);
+    OutputDevice::createDeviceByOption("step-profile", "step-profile");
+    MSStepProfiler::init();
+    ASSERT_TRUE(MSStepProfiler::isEnabled());
+    // a step which is not executed is not counted
+    MSStepProfiler::beginStep();
+    {
+        STEP_PROFILE_PHASE(TRACI);
+    }
+    MSStepProfiler::addReroute();
+    MSStepProfiler::discardStep();
+    for (int i = 0; i < 2; i++) {
+        MSStepProfiler::beginStep();
+        {
+            STEP_PROFILE_PHASE(PLAN_MOVEMENTS);
+        }
+        MSStepProfiler::addReroute();
+        MSStepProfiler::endStep(i * 1000, 3, 1, 2);
+    }
+    const std::string summary = MSStepProfiler::writeSummary();
+    EXPECT_EQ(0, (int)summary.find("Step profile: 2 steps"));
+    OutputDevice::closeAll();
+    std::ifstream strm(file.c_str());
+    std::stringstream content;
+    content << strm.rdbuf();
+    const std::string xml = content.str();
+    EXPECT_NE(std::string::npos, xml.find("<step time=\"1.00\""));
+    EXPECT_NE(std::string::npos, xml.find("activeLanes=\"3\" reroutes=\"1\" inserted=\"1\" running=\"2\""));
+    EXPECT_NE(std::string::npos, xml.find("<summary steps=\"2\""));
+    EXPECT_NE(std::string::npos, xml.find("reroutes=\"2\" inserted=\"2\""));
+    strm.close();
+    std::remove(file.c_str());
+    // disable the profiler again
+    oc.clear();
+    oc.doRegister("step-profile", new Option_FileName());
+    MSStepProfiler::init();
+    oc.clear();
+}
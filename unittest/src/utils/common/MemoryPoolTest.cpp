@@ -0,0 +1,80 @@
+/****************************************************************************/
+/// @file    MemoryPoolTest.cpp
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the class MemoryPool
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <utils/common/MemoryPool.h>
+
+/*
+Tests MemoryPool class from <SUMO>/src/utils/common
+*/
+
+/* Test that freed memory is reused by objects of the same size class only. */
+TEST(MemoryPool, test_reuse_by_size_class) {
+    MemoryPool::clear();
+    const int live = MemoryPool::getLiveObjects();
+    void* a = MemoryPool::allocate(40);
+    EXPECT_EQ(live + 1, MemoryPool::getLiveObjects());
+    MemoryPool::deallocate(a, 40);
+    EXPECT_EQ(live, MemoryPool::getLiveObjects());
+    EXPECT_EQ(1, MemoryPool::getPooledObjects());
+    EXPECT_EQ(48, MemoryPool::getPooledBytes());
+    // a smaller object of another size class does not get the block
+    void* b = MemoryPool::allocate(24);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(1, MemoryPool::getPooledObjects());
+    // an object of the same size class does
+    void* c = MemoryPool::allocate(33);
+    EXPECT_EQ(a, c);
+    EXPECT_EQ(0, MemoryPool::getPooledObjects());
+    EXPECT_EQ(0, MemoryPool::getPooledBytes());
+    MemoryPool::deallocate(b, 24);
+    MemoryPool::deallocate(c, 33);
+    EXPECT_EQ(2, MemoryPool::getPooledObjects());
+    MemoryPool::clear();
+    EXPECT_EQ(0, MemoryPool::getPooledObjects());
+    EXPECT_EQ(0, MemoryPool::getPooledBytes());
+}
+
+
+/* Test that large objects are not kept. */
+TEST(MemoryPool, test_large_objects) {
+    MemoryPool::clear();
+    const int live = MemoryPool::getLiveObjects();
+    void* a = MemoryPool::allocate(MemoryPool::MAX_POOLED_SIZE + 1);
+    EXPECT_EQ(live + 1, MemoryPool::getLiveObjects());
+    MemoryPool::deallocate(a, MemoryPool::MAX_POOLED_SIZE + 1);
+    EXPECT_EQ(live, MemoryPool::getLiveObjects());
+    EXPECT_EQ(0, MemoryPool::getPooledObjects());
+    MemoryPool::deallocate(0, 8);
+    EXPECT_EQ(live, MemoryPool::getLiveObjects());
+}
+
+
+/* Test the statistics description. */
+TEST(MemoryPool, test_statistics) {
+    MemoryPool::clear();
+    void* a = MemoryPool::allocate(16);
+    MemoryPool::deallocate(a, 16);
+    void* b = MemoryPool::allocate(1);
+    const std::string stats = MemoryPool::getStatistics();
+    EXPECT_NE(std::string::npos, stats.find("objects live"));
+    EXPECT_NE(std::string::npos, stats.find("0 freed objects (0kB) kept"));
+    MemoryPool::deallocate(b, 1);
+    MemoryPool::clear();
+}
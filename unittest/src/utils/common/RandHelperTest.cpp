@@ -0,0 +1,59 @@
+/****************************************************************************/
+/// @file    RandHelperTest.cpp
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the class RandHelper
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <utils/common/RandHelper.h>
+
+/*
+Tests RandHelper class from <SUMO>/src/utils/common
+*/
+
+/* Test that counter-based random numbers are in [0, 1) and depend only on stream and counter. */
+TEST(RandHelper, test_counter_based_is_stateless) {
+    const unsigned long long streamA = RandHelper::getStreamID("veh0");
+    const unsigned long long streamB = RandHelper::getStreamID("veh1");
+    std::vector<SUMOReal> a;
+    for (int i = 0; i < 100; i++) {
+        a.push_back(RandHelper::randCounterBased(streamA, i));
+        EXPECT_LE(0., a.back());
+        EXPECT_GT(1., a.back());
+        // interleaved draws of another stream must not change the results
+        RandHelper::randCounterBased(streamB, i);
+    }
+    for (int i = 99; i >= 0; i--) {
+        EXPECT_EQ(a[i], RandHelper::randCounterBased(streamA, i));
+    }
+    EXPECT_NE(RandHelper::randCounterBased(streamA, 0), RandHelper::randCounterBased(streamB, 0));
+}
+
+/* Test that the stream ids are stable. */
+TEST(RandHelper, test_stream_id) {
+    EXPECT_EQ(14695981039346656037ULL, RandHelper::getStreamID(""));
+    EXPECT_EQ(RandHelper::getStreamID("veh0"), RandHelper::getStreamID("veh0"));
+    EXPECT_NE(RandHelper::getStreamID("veh0"), RandHelper::getStreamID("veh1"));
+}
+
+/* Test that the draws are roughly uniformly distributed. */
+TEST(RandHelper, test_counter_based_mean) {
+    SUMOReal sum = 0;
+    for (int i = 0; i < 10000; i++) {
+        sum += RandHelper::randCounterBased(42, i);
+    }
+    EXPECT_NEAR(0.5, sum / 10000, 0.01);
+}
@@ -0,0 +1,112 @@
+/****************************************************************************/
+/// @file    RandomDistributorTest.cpp
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the class RandomDistributor
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include <utils/common/RandomDistributor.h>
+#include <utils/common/SysUtils.h>
+
+/*
+Tests RandomDistributor class from <SUMO>/src/utils/common
+*/
+
+/* Test that the alias method draws members according to their probabilities. */
+TEST(RandomDistributor, test_alias_table_frequencies) {
+    MTRand rng(42);
+    RandomDistributor<int> dist(true);
+    dist.add(1., 0);
+    dist.add(0., 1);
+    dist.add(3., 2);
+    dist.add(2., 3);
+    dist.add(2., 0);
+    dist.buildAliasTable();
+    std::vector<int> counts(4, 0);
+    const int samples = 80000;
+    for (int i = 0; i < samples; i++) {
+        counts[dist.get(&rng)]++;
+    }
+    EXPECT_NEAR(3. / 8., (SUMOReal)counts[0] / samples, 0.01);
+    EXPECT_EQ(0, counts[1]);
+    EXPECT_NEAR(3. / 8., (SUMOReal)counts[2] / samples, 0.01);
+    EXPECT_NEAR(2. / 8., (SUMOReal)counts[3] / samples, 0.01);
+}
+
+/* Test that the alias table has to be rebuilt after the distribution changed. */
+TEST(RandomDistributor, test_alias_table_update) {
+    MTRand rng(42);
+    RandomDistributor<int> dist(true);
+    dist.add(1., 0);
+    EXPECT_THROW(dist.get(&rng), ProcessError);
+    dist.buildAliasTable();
+    EXPECT_EQ(0, dist.get(&rng));
+    dist.clear();
+    dist.add(0., 0);
+    dist.add(1., 1);
+    dist.buildAliasTable();
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(1, dist.get(&rng));
+    }
+    dist.add(1., 0);
+    EXPECT_THROW(dist.get(&rng), ProcessError);
+    dist.buildAliasTable();
+    int zeros = 0;
+    for (int i = 0; i < 1000; i++) {
+        if (dist.get(&rng) == 0) {
+            zeros++;
+        }
+    }
+    EXPECT_LT(400, zeros);
+    EXPECT_GT(600, zeros);
+}
+
+
+/* Compares the time needed for drawing by scanning the members and by the alias method for several sizes */
+TEST(RandomDistributor, test_benchmark_aliasTable) {
+    const int draws = 100000;
+    for (int size = 10; size <= 10000; size *= 10) {
+        RandomDistributor<int> scan;
+        RandomDistributor<int> alias(true);
+        for (int i = 0; i < size; i++) {
+            // uneven weights so that the alias table is not trivial
+            scan.add((SUMOReal)(i % 7 + 1), i, false);
+            alias.add((SUMOReal)(i % 7 + 1), i, false);
+        }
+        long begin = SysUtils::getCurrentMillis();
+        alias.buildAliasTable();
+        const long durationBuild = SysUtils::getCurrentMillis() - begin;
+        MTRand rng(42);
+        long sumScan = 0;
+        begin = SysUtils::getCurrentMillis();
+        for (int i = 0; i < draws; i++) {
+            sumScan += scan.get(&rng);
+        }
+        const long durationScan = SysUtils::getCurrentMillis() - begin;
+        long sumAlias = 0;
+        begin = SysUtils::getCurrentMillis();
+        for (int i = 0; i < draws; i++) {
+            sumAlias += alias.get(&rng);
+        }
+        const long durationAlias = SysUtils::getCurrentMillis() - begin;
+        // both draw members with the same distribution, so their means are close
+        EXPECT_NEAR((SUMOReal)sumScan / draws, (SUMOReal)sumAlias / draws, 0.02 * size);
+        std::cout << "    " << draws << " draws from " << size << " members: "
+                  << durationScan << "ms scanning, " << durationAlias << "ms alias method (+"
+                  << durationBuild << "ms building the table)\n";
+    }
+}
@@ -217,3 +217,43 @@ TEST(ValueTimeLine, test_fill_gaps_nobounds) {
 }
 
 
+
+
+// --------------------------------
+// lookup tests
+// --------------------------------
+
+/* Tests the lookup in many regular intervals. */
+TEST(ValueTimeLine, test_get_many_regular) {
+    ValueTimeLine<int> vtl;
+    for (int i = 0; i < 96; ++i) {
+        vtl.add(i * 900, (i + 1) * 900, i);
+    }
+    for (int i = 0; i < 96; ++i) {
+        EXPECT_EQ(i, vtl.getValue(i * 900));
+        EXPECT_EQ(i, vtl.getValue(i * 900 + 899.5));
+        EXPECT_TRUE(vtl.describesTime(i * 900 + 450));
+    }
+    EXPECT_FALSE(vtl.describesTime(96 * 900));
+    EXPECT_EQ(900, vtl.getSplitTime(800, 1000));
+    EXPECT_EQ(-1, vtl.getSplitTime(800, 2000));
+}
+
+/* Tests the lookup in irregular intervals. */
+TEST(ValueTimeLine, test_get_many_irregular) {
+    ValueTimeLine<int> vtl;
+    vtl.add(0, 1, 1);
+    vtl.add(1, 2, 2);
+    vtl.add(2, 3, 3);
+    vtl.add(3, 10000, 4);
+    vtl.add(10000, 10001, 5);
+    vtl.fillGaps(0);
+    EXPECT_EQ(0, vtl.getValue(-1));
+    EXPECT_EQ(1, vtl.getValue(0.5));
+    EXPECT_EQ(3, vtl.getValue(2));
+    EXPECT_EQ(4, vtl.getValue(3));
+    EXPECT_EQ(4, vtl.getValue(9999));
+    EXPECT_EQ(5, vtl.getValue(10000.5));
+    EXPECT_EQ(0, vtl.getValue(10001));
+    EXPECT_FALSE(vtl.describesTime(10001));
+}
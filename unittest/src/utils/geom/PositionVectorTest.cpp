@@ -26,6 +26,7 @@
 #include <utils/geom/GeomHelper.h>
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/SysUtils.h>
 #include <utils/iodevices/OutputDevice.h>
 
 
@@ -527,3 +528,91 @@ TEST_F(PositionVectorTest, test_method_distances) {
     }
 
 }
+
+
+/* Builds a winding shape with elevation as imported from OSM */
+static PositionVector buildLongShape(int numPoints) {
+    PositionVector result;
+    for (int i = 0; i < numPoints; ++i) {
+        result.push_back(Position(i * 3., (i % 7) * 1.5 - (i % 3), (i % 5) * 0.2));
+    }
+    return result;
+}
+
+
+/* Test that the length index gives the same results as walking along the shape */
+TEST_F(PositionVectorTest, test_method_buildLengthIndex) {
+    const PositionVector plain = buildLongShape(150);
+    PositionVector indexed = plain;
+    indexed.buildLengthIndex();
+    EXPECT_DOUBLE_EQ(plain.length(), indexed.length());
+    EXPECT_DOUBLE_EQ(plain.length2D(), indexed.length2D());
+    const SUMOReal length = plain.length();
+    for (SUMOReal pos = -2.; pos < length + 2.; pos += 0.7) {
+        const Position p1 = plain.positionAtOffset(pos, 0.5);
+        const Position p2 = indexed.positionAtOffset(pos, 0.5);
+        EXPECT_DOUBLE_EQ(p1.x(), p2.x());
+        EXPECT_DOUBLE_EQ(p1.y(), p2.y());
+        EXPECT_DOUBLE_EQ(p1.z(), p2.z());
+        const Position p3 = plain.positionAtOffset2D(pos);
+        const Position p4 = indexed.positionAtOffset2D(pos);
+        EXPECT_DOUBLE_EQ(p3.x(), p4.x());
+        EXPECT_DOUBLE_EQ(p3.y(), p4.y());
+        EXPECT_DOUBLE_EQ(plain.rotationAtOffset(pos), indexed.rotationAtOffset(pos));
+        EXPECT_DOUBLE_EQ(plain.slopeDegreeAtOffset(pos), indexed.slopeDegreeAtOffset(pos));
+        EXPECT_DOUBLE_EQ(plain.nearest_offset_to_point2D(p1), indexed.nearest_offset_to_point2D(p1));
+    }
+    // boundaries between segments
+    EXPECT_DOUBLE_EQ(plain.rotationAtOffset(plain[0].distanceTo(plain[1])), indexed.rotationAtOffset(plain[0].distanceTo(plain[1])));
+    EXPECT_DOUBLE_EQ(plain.rotationAtOffset(0), indexed.rotationAtOffset(0));
+    EXPECT_DOUBLE_EQ(plain.rotationAtOffset(length), indexed.rotationAtOffset(length));
+}
+
+
+/* Test that the length index is not used after changing the positions */
+TEST_F(PositionVectorTest, test_method_buildLengthIndex_invalidation) {
+    PositionVector indexed = *vectorLine;
+    indexed.buildLengthIndex();
+    indexed.push_back(Position(2, 4));
+    EXPECT_DOUBLE_EQ(2 * sqrt(2.) + 2, indexed.length());
+    indexed.add(0, 1, 0);
+    EXPECT_DOUBLE_EQ(4.5, indexed.positionAtOffset(2 * sqrt(2.) + 1.5).y());
+    indexed.buildLengthIndex();
+    indexed.rotate2D(M_PI / 2);
+    EXPECT_DOUBLE_EQ(M_PI, indexed.rotationAtOffset(2 * sqrt(2.) + 1.5));
+    // the index is not copied, so changing the copy using operator[] is safe
+    indexed.buildLengthIndex();
+    PositionVector copy = indexed;
+    copy[2] = copy[1];
+    EXPECT_DOUBLE_EQ(2 * sqrt(2.), copy.length());
+    copy = indexed;
+    copy[2] = copy[1];
+    EXPECT_DOUBLE_EQ(2 * sqrt(2.), copy.length());
+}
+
+
+/* Compares the time needed for offset lookups on a long shape with and without the length index */
+TEST_F(PositionVectorTest, test_benchmark_lengthIndex) {
+    const PositionVector plain = buildLongShape(200);
+    PositionVector indexed = plain;
+    indexed.buildLengthIndex();
+    const SUMOReal length = plain.length();
+    const int lookups = 20000;
+    SUMOReal sumPlain = 0;
+    long begin = SysUtils::getCurrentMillis();
+    for (int i = 0; i < lookups; ++i) {
+        const SUMOReal pos = length * (i % 1000) / 1000.;
+        sumPlain += plain.positionAtOffset(pos).x() + plain.rotationAtOffset(pos);
+    }
+    const long durationPlain = SysUtils::getCurrentMillis() - begin;
+    SUMOReal sumIndexed = 0;
+    begin = SysUtils::getCurrentMillis();
+    for (int i = 0; i < lookups; ++i) {
+        const SUMOReal pos = length * (i % 1000) / 1000.;
+        sumIndexed += indexed.positionAtOffset(pos).x() + indexed.rotationAtOffset(pos);
+    }
+    const long durationIndexed = SysUtils::getCurrentMillis() - begin;
+    EXPECT_DOUBLE_EQ(sumPlain, sumIndexed);
+    std::cout << "    " << lookups << " lookups on " << plain.size() << " points: "
+              << durationPlain << "ms walking, " << durationIndexed << "ms indexed\n";
+}
@@ -0,0 +1,167 @@
+/****************************************************************************/
+/// @file    BinaryInputDeviceTest.cpp
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the class BinaryInputDevice
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/common/UtilExceptions.h>
+#include <utils/geom/Position.h>
+#include <utils/iodevices/BinaryFormatter.h>
+#include <utils/iodevices/BinaryInputDevice.h>
+#include <utils/xml/SUMOSAXAttributesImpl_Binary.h>
+
+/*
+Tests BinaryInputDevice class from <SUMO>/src/utils/iodevices
+*/
+
+class BinaryInputDeviceTest : public testing::Test {
+protected:
+    virtual void SetUp() {
+        myFile = "BinaryInputDeviceTest.bin";
+        std::ofstream strm(myFile.c_str(), std::ios::binary);
+        FileHelpers::writeByte(strm, BinaryFormatter::BF_BYTE);
+        FileHelpers::writeByte(strm, 7);
+        FileHelpers::writeByte(strm, BinaryFormatter::BF_STRING);
+        FileHelpers::writeString(strm, "edge_1");
+        FileHelpers::writeByte(strm, BinaryFormatter::BF_LIST);
+        FileHelpers::writeInt(strm, 2);
+        FileHelpers::writeByte(strm, BinaryFormatter::BF_INTEGER);
+        FileHelpers::writeInt(strm, -3);
+        FileHelpers::writeByte(strm, BinaryFormatter::BF_INTEGER);
+        FileHelpers::writeInt(strm, 42);
+        FileHelpers::writeByte(strm, BinaryFormatter::BF_SCALED2INT_POSITION_3D);
+        FileHelpers::writeInt(strm, 150);
+        FileHelpers::writeInt(strm, -250);
+        FileHelpers::writeInt(strm, 100);
+        // an untyped int following a typed one as written for lanes
+        FileHelpers::writeByte(strm, BinaryFormatter::BF_INTEGER);
+        FileHelpers::writeInt(strm, 5);
+        FileHelpers::writeInt(strm, 6);
+    }
+
+    virtual void TearDown() {
+        std::remove(myFile.c_str());
+    }
+
+    std::string myFile;
+};
+
+
+/* Test reading all values written. */
+TEST_F(BinaryInputDeviceTest, test_read_typed) {
+    BinaryInputDevice in(myFile, true);
+    EXPECT_TRUE(in.good());
+    EXPECT_EQ(BinaryFormatter::BF_BYTE, in.peek());
+    char c;
+    in >> c;
+    EXPECT_EQ(7, c);
+    std::string s;
+    in >> s;
+    EXPECT_EQ("edge_1", s);
+    std::vector<int> v;
+    in >> v;
+    ASSERT_EQ(2, (int)v.size());
+    EXPECT_EQ(-3, v[0]);
+    EXPECT_EQ(42, v[1]);
+    Position p;
+    in >> p;
+    EXPECT_DOUBLE_EQ(1.5, p.x());
+    EXPECT_DOUBLE_EQ(-2.5, p.y());
+    EXPECT_DOUBLE_EQ(1., p.z());
+    int i;
+    in >> i;
+    EXPECT_EQ(5, i);
+    // the type of the next value is not stored but given by putback
+    in.putback(BinaryFormatter::BF_INTEGER);
+    EXPECT_EQ(BinaryFormatter::BF_INTEGER, in.peek());
+    in >> i;
+    EXPECT_EQ(6, i);
+    EXPECT_EQ(EOF, in.peek());
+    EXPECT_TRUE(in.good());
+}
+
+
+/* Test reading beyond the end of the file. */
+TEST_F(BinaryInputDeviceTest, test_read_beyond_end) {
+    BinaryInputDevice in(myFile, true);
+    EXPECT_EQ(2, (int)in.read(2).size());
+    std::string s;
+    in >> s;
+    EXPECT_EQ("edge_1", s);
+    EXPECT_EQ(37, (int)in.read(37).size());
+    EXPECT_EQ(EOF, in.peek());
+    int i;
+    EXPECT_THROW(in >> i, ProcessError);
+    EXPECT_FALSE(in.good());
+}
+
+
+/* Test reading a missing file. */
+TEST_F(BinaryInputDeviceTest, test_missing_file) {
+    BinaryInputDevice in("BinaryInputDeviceTest.missing");
+    EXPECT_FALSE(in.good());
+    EXPECT_EQ(EOF, in.peek());
+}
+
+
+/* Test reading a string with a negative length. */
+TEST(BinaryInputDevice, test_negative_string_length) {
+    const std::string file = "BinaryInputDeviceTest_negative.bin";
+    {
+        std::ofstream strm(file.c_str(), std::ios::binary);
+        FileHelpers::writeByte(strm, BinaryFormatter::BF_STRING);
+        FileHelpers::writeInt(strm, -4);
+        FileHelpers::writeString(strm, "edge_1");
+    }
+    BinaryInputDevice in(file, true);
+    std::string s;
+    EXPECT_THROW(in >> s, ProcessError);
+    EXPECT_FALSE(in.good());
+    std::remove(file.c_str());
+}
+
+
+/* Test that the attributes of the root element keep their types. */
+TEST(BinaryInputDevice, test_root_attributes_round_trip) {
+    const std::string file = "BinaryInputDeviceTest_root.sbx";
+    {
+        std::ofstream strm(file.c_str(), std::ios::binary);
+        BinaryFormatter formatter;
+        formatter.writeXMLHeader(strm, "net", " version=\"0.27\" lefthand=\"true\" junctionCornerDetail=\"5\" junctionLinkDetail=\"3\"");
+    }
+    BinaryInputDevice in(file, true);
+    char c;
+    std::string s;
+    std::vector<std::string> strings;
+    std::vector<std::vector<int> > followers;
+    in >> c >> s >> strings >> strings >> strings >> strings >> strings >> followers;
+    ASSERT_EQ(BinaryFormatter::BF_XML_TAG_START, in.peek());
+    in >> c;
+    EXPECT_EQ(SUMO_TAG_NET, (SumoXMLTag)c);
+    std::map<int, std::string> names;
+    SUMOSAXAttributesImpl_Binary attrs(names, "net", &in);
+    bool ok = true;
+    EXPECT_EQ("0.27", attrs.getString(SUMO_ATTR_VERSION));
+    EXPECT_TRUE(attrs.getOpt<bool>(SUMO_ATTR_LEFTHAND, 0, ok, false));
+    EXPECT_EQ(5, attrs.getOpt<int>(SUMO_ATTR_CORNERDETAIL, 0, ok, 0));
+    EXPECT_EQ(3, attrs.getOpt<int>(SUMO_ATTR_LINKDETAIL, 0, ok, -1));
+    EXPECT_TRUE(ok);
+    std::remove(file.c_str());
+}
@@ -0,0 +1,117 @@
+/****************************************************************************/
+/// @file    RouteCacheTest.cpp
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the classes RouteCache and CachedRouter
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.dlr.de/
+// Copyright (C) 2001-2016 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <utils/vehicle/RouteCache.h>
+
+/*
+Tests RouteCache and CachedRouter classes from <SUMO>/src/utils/vehicle
+*/
+
+struct TestEdge {
+    int id;
+};
+
+struct TestVehicle {
+    SUMOVehicleClass getVClass() const {
+        return vClass;
+    }
+    SUMOVehicleClass vClass;
+};
+
+/// @brief a router returning the direct connection and counting its queries
+class CountingRouter : public SUMOAbstractRouter<TestEdge, TestVehicle> {
+public:
+    CountingRouter() : SUMOAbstractRouter<TestEdge, TestVehicle>(0, "CountingRouter"), queries(0) {}
+    SUMOAbstractRouter<TestEdge, TestVehicle>* clone() {
+        return new CountingRouter();
+    }
+    bool compute(const TestEdge* from, const TestEdge* to, const TestVehicle* const,
+                 SUMOTime, std::vector<const TestEdge*>& into) {
+        queries++;
+        into.push_back(from);
+        into.push_back(to);
+        return true;
+    }
+    SUMOReal recomputeCosts(const std::vector<const TestEdge*>& edges, const TestVehicle* const, SUMOTime) const {
+        return (SUMOReal)edges.size();
+    }
+    int queries;
+};
+
+
+/* Test storing and retrieving routes per key. */
+TEST(RouteCache, test_get_add) {
+    TestEdge e[3] = {{0}, {1}, {2}};
+    std::vector<const TestEdge*> route;
+    route.push_back(&e[0]);
+    route.push_back(&e[1]);
+    route.push_back(&e[2]);
+    RouteCache<TestEdge> cache;
+    std::vector<const TestEdge*> into;
+    EXPECT_FALSE(cache.get(&e[0], &e[2], SVC_PASSENGER, 0, into));
+    cache.add(&e[0], &e[2], SVC_PASSENGER, 0, cache.getEpoch(), route.begin(), route.end());
+    EXPECT_FALSE(cache.get(&e[0], &e[2], SVC_BUS, 0, into));
+    EXPECT_FALSE(cache.get(&e[0], &e[2], SVC_PASSENGER, 1, into));
+    EXPECT_TRUE(cache.get(&e[0], &e[2], SVC_PASSENGER, 0, into));
+    EXPECT_EQ(route, into);
+    EXPECT_EQ(1, cache.getHits());
+    EXPECT_EQ(3, cache.getMisses());
+}
+
+
+/* Test that invalidation removes the routes and rejects results of older queries. */
+TEST(RouteCache, test_invalidate) {
+    TestEdge e[2] = {{0}, {1}};
+    std::vector<const TestEdge*> route;
+    route.push_back(&e[0]);
+    route.push_back(&e[1]);
+    RouteCache<TestEdge> cache;
+    const int epoch = cache.getEpoch();
+    cache.add(&e[0], &e[1], SVC_PASSENGER, 0, epoch, route.begin(), route.end());
+    cache.invalidate();
+    std::vector<const TestEdge*> into;
+    EXPECT_FALSE(cache.get(&e[0], &e[1], SVC_PASSENGER, 0, into));
+    cache.add(&e[0], &e[1], SVC_PASSENGER, 0, epoch, route.begin(), route.end());
+    EXPECT_FALSE(cache.get(&e[0], &e[1], SVC_PASSENGER, 0, into));
+    EXPECT_TRUE(into.empty());
+}
+
+
+/* Test that the cached router asks the wrapped router once per key and time slot. */
+TEST(CachedRouter, test_compute) {
+    TestEdge e[3] = {{0}, {1}, {2}};
+    TestVehicle car = {SVC_PASSENGER};
+    RouteCache<TestEdge> cache;
+    CountingRouter* counting = new CountingRouter();
+    CachedRouter<TestEdge, TestVehicle> router(counting, cache, 100);
+    std::vector<const TestEdge*> into;
+    router.compute(&e[0], &e[1], &car, 0, into);
+    router.compute(&e[0], &e[1], &car, 99, into);
+    EXPECT_EQ(1, counting->queries);
+    ASSERT_EQ(4, (int)into.size());
+    EXPECT_EQ(&e[0], into[2]);
+    EXPECT_EQ(&e[1], into[3]);
+    router.compute(&e[0], &e[1], &car, 100, into);
+    router.compute(&e[1], &e[2], &car, 0, into);
+    EXPECT_EQ(3, counting->queries);
+    cache.invalidate();
+    router.compute(&e[0], &e[1], &car, 0, into);
+    EXPECT_EQ(4, counting->queries);
+}